@@ -73,6 +73,14 @@
 #define RCC_APP2_TIM9_EN           19
 #define RCC_APP2_TIM10_EN          20
 #define RCC_APP2_TIM11_EN          21
+/********************************< RTC CLOCK SOURCES (RTCSEL) ********************************/
+#define RCC_RTC_CLOCK_LSE          1   /**< 32.768 kHz external crystal, kept by VBAT */
+#define RCC_RTC_CLOCK_LSI          2   /**< ~40 kHz internal RC, stops with the main supply and after a reset */
+#define RCC_RTC_CLOCK_HSE_DIV128   3   /**< HSE divided by 128 */
+/********************************< RTC CLOCK START STATUS ********************************/
+#define RCC_RTC_CLOCK_FAILED       0   /**< The oscillator did not start */
+#define RCC_RTC_CLOCK_STARTED      1   /**< The RTC clock was selected now, the RTC must be configured */
+#define RCC_RTC_CLOCK_KEPT         2   /**< The RTC already ran on this clock (backup domain kept), nothing was changed */
 /********************************< FUNCTIONs PROTOTYPE ********************************/
 /**
  * @brief Initializes the system clock according to the selected clock type and input.
@@ -160,7 +168,7 @@ void RCC_DisableClock(u8 Copy_BusId, u8 Copy_PeriphId);
 /**
  * @brief Returns the system clock frequency.
  *
- * This function reads the RCC_CFGR_R register to determine the current system clock source and frequency. If the system clock is derived from the HSI oscillator, the frequency is fixed at 16 MHz. If it is derived from the HSE oscillator, the frequency is determined by the value of the RCC_HSE_VALUE constant. If it is derived from the PLL, the frequency is calculated based on the PLL input clock frequency and the PLL multiplication factor.
+ * This function reads the RCC_CFGR_R register to determine the current system clock source and frequency. If the system clock is derived from the HSI oscillator, the frequency is fixed at 8 MHz. If it is derived from the HSE oscillator, the frequency is determined by the value of the RCC_HSE_VALUE constant. If it is derived from the PLL, the frequency is calculated based on the PLL input clock frequency and the PLL multiplication factor.
  *
  * @note
  * The constant RCC_HSE_VALUE should be defined in the header file and represents the frequency of the external crystal or oscillator used as the HSE clock source.
@@ -169,5 +177,47 @@ void RCC_DisableClock(u8 Copy_BusId, u8 Copy_PeriphId);
  */
 u32 RCC_GetSystemClockFreq(void);
 
+/**
+ * @brief Returns the AHB clock (HCLK) frequency.
+ *
+ * This is the clock of the Cortex-M3 core, of its cycle counter and of the SysTick. It is the system clock divided by the AHB prescaler.
+ *
+ * @retval The AHB clock frequency in Hz.
+ */
+u32 RCC_GetAHBClockFreq(void);
+
+/**
+ * @brief Returns the clock frequency of the timers on APB1 (TIM2 to TIM7).
+ *
+ * It is the APB1 clock, multiplied by 2 when the APB1 prescaler divides the AHB clock.
+ *
+ * @retval The timers clock frequency in Hz.
+ */
+u32 RCC_GetAPB1TimerClockFreq(void);
+
+/**
+ * @brief Enables the write access to the backup domain (RTC, RCC_BDCR and backup registers).
+ *
+ * It enables the PWR and BKP clocks and sets the DBP bit of PWR_CR.
+ *
+ * @retval None
+ */
+void RCC_EnableBackupDomainAccess(void);
+
+/**
+ * @brief Starts the oscillator of the RTC and selects it as the RTC clock.
+ *
+ * The backup domain survives the resets (and keeps running on VBAT with the LSE), so when the RTC already runs on the
+ * requested clock it is left as is. Selecting another clock resets the backup domain, the only way to change RTCSEL.
+ * The LSI is not in the backup domain and is switched on again in all cases.
+ *
+ * @note RCC_EnableBackupDomainAccess() must be called before.
+ *
+ * @param[in] Copy_Source RCC_RTC_CLOCK_LSE, RCC_RTC_CLOCK_LSI or RCC_RTC_CLOCK_HSE_DIV128.
+ *
+ * @retval RCC_RTC_CLOCK_STARTED, RCC_RTC_CLOCK_KEPT or RCC_RTC_CLOCK_FAILED.
+ */
+u8 RCC_StartRtcClock(u8 Copy_Source);
+
 
 #endif /**< __RCC_INTERFACE_H__ */
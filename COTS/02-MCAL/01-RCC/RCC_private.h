@@ -30,6 +30,7 @@
 
 
 #define RCC_HSE_VALUE				8000000
+#define RCC_HSI_VALUE				8000000 /**< The internal RC oscillator of the STM32F10x */
 
 
 
@@ -67,6 +68,37 @@
 										when PLL is disabled.
 										0: HSE clock not divided
 										1: HSE clock divided by 2 */
+#define RCC_SWS_POS				2	/**< Bits 3:2 SWS: System clock switch status */
+#define RCC_SWS_MASK			0x3
+#define RCC_SWS_HSI				0	/**< 00: HSI oscillator used as system clock */
+#define RCC_SWS_HSE				1	/**< 01: HSE oscillator used as system clock */
+#define RCC_SWS_PLL				2	/**< 10: PLL used as system clock */
+#define RCC_HPRE_POS			4	/**< Bits 7:4 HPRE: AHB prescaler */
+#define RCC_HPRE_MASK			0xF
+#define RCC_PPRE1_POS			8	/**< Bits 10:8 PPRE1: APB low-speed prescaler (APB1) */
+#define RCC_PPRE1_MASK			0x7
+#define RCC_PLLMUL_POS			18	/**< Bits 21:18 PLLMUL: PLL multiplication factor */
+#define RCC_PLLMUL_MASK			0xF
+
+/**< Division of the AHB prescaler as a shift: 0xxx not divided, 1000 /2, 1001 /4, 1010 /8, 1011 /16, 1100 /64 ... 1111 /512 */
+static const u8 RCC_AHBPrescalerShift[16] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 7, 8, 9};
+
+#define RCC_PWREN_BIT			28	/**< RCC_APB1ENR: power interface clock enable */
+#define RCC_BKPEN_BIT			27	/**< RCC_APB1ENR: backup interface clock enable */
+#define RCC_LSEON_BIT			0	/**< RCC_BDCR: external low-speed oscillator enable */
+#define RCC_LSERDY_BIT			1	/**< RCC_BDCR: external low-speed oscillator ready */
+#define RCC_RTCSEL_POS			8	/**< RCC_BDCR bits 9:8: RTC clock source selection */
+#define RCC_RTCSEL_MASK			0x3
+#define RCC_RTCEN_BIT			15	/**< RCC_BDCR: RTC clock enable */
+#define RCC_BDRST_BIT			16	/**< RCC_BDCR: backup domain software reset */
+#define RCC_LSION_BIT			0	/**< RCC_CSR: internal low-speed oscillator enable */
+#define RCC_LSIRDY_BIT			1	/**< RCC_CSR: internal low-speed oscillator ready */
+#define RCC_LSE_TIMEOUT			0x005FFFFFUL	/**< Polls of LSERDY, the crystal takes up to a few seconds */
+
+/**< Power control register, its DBP bit unlocks the backup domain */
+#define RCC_PWR_CR_R			*((volatile u32 *)0X40007000)
+#define RCC_PWR_DBP_BIT			8
+
 #define RCC_CIR_R				*((volatile u32 *)0X40021008)
 #define RCC_APB2RSTR_R			*((volatile u32 *)0X4002100C)
 #define RCC_APB1RSTR_R			*((volatile u32 *)0X40021010)
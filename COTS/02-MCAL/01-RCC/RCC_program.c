@@ -91,41 +91,114 @@ void MRCC_voidDisableClock(u8 Copy_BusId,u8 Copy_PeriphId)
 
 
 
-// u32 MRCC_GetSystemClockFreq(void)
-// {
-//     u32 Local_u32Freq = 0;
-//     u8 clk_src = (RCC_CFGR_R >> 2) & 0x3;
-
-//     switch (clk_src)
-//     {
-//         case 0x00: // HSI oscillator used as system clock
-//             Local_u32Freq = 16000000; // HSI frequency is fixed at 16 MHz
-//         break;
-        
-//         case 0x01: // HSE oscillator used as system clock
-//             Local_u32Freq = RCC_HSE_VALUE; // HSE_VALUE should be defined properly
-//         break;
-        
-//         case 0x02: // PLL used as system clock
-//             u8 pll_src = (RCC_CFGR_R >> 16) & 0x3;
-//             u32 pll_input_freq = 0;
-
-//             switch (pll_src)
-//             {
-//                 case 0x00: // HSI oscillator divided by 2 used as PLL input clock
-//                     pll_input_freq = 8000000; // HSI frequency divided by 2 is fixed at 8 MHz
-//                 break;
-//                 case 0x01: // HSE oscillator divided by 2 used as PLL input clock
-//                     pll_input_freq = RCC_HSE_VALUE / 2;
-//                 break;
-//                 case 0x02: // HSE oscillator not divided used as PLL input clock
-//                     pll_input_freq = RCC_HSE_VALUE;
-//                 break;
-//             }
-//             u8 pll_mul = (RCC_CFGR_R >> 18) & 0xF;
-//             freq = pll_input_freq * pll_mul;
-//         break;
-//     }
-
-//     return Local_u32Freq;
-// }
+u32 RCC_GetSystemClockFreq(void)
+{
+	u32 Local_u32Freq = 0;
+	u32 Local_u32PllInput;
+
+	switch ((RCC_CFGR_R >> RCC_SWS_POS) & RCC_SWS_MASK)
+	{
+		case RCC_SWS_HSI: Local_u32Freq = RCC_HSI_VALUE; break;	/**< HSI oscillator used as system clock */
+		case RCC_SWS_HSE: Local_u32Freq = RCC_HSE_VALUE; break;	/**< HSE oscillator used as system clock */
+		case RCC_SWS_PLL:										/**< PLL used as system clock */
+			if (GET_BIT(RCC_CFGR_R, RCC_PLLSRC_BIT))
+			{
+				/**< HSE, divided by 2 when PLLXTPRE is set */
+				Local_u32PllInput = RCC_HSE_VALUE >> GET_BIT(RCC_CFGR_R, RCC_PLLXTPRE_BIT);
+			}
+			else
+			{
+				Local_u32PllInput = RCC_HSI_VALUE / 2;
+			}
+			/**< PLLMUL 0000 is x2 ... 1110 is x16, 1111 is x16 too */
+			Local_u32Freq = ((RCC_CFGR_R >> RCC_PLLMUL_POS) & RCC_PLLMUL_MASK) + 2;
+			if (Local_u32Freq > 16)
+			{
+				Local_u32Freq = 16;
+			}
+			Local_u32Freq *= Local_u32PllInput;
+		break;
+		default: /**< Not applicable */ break;
+	}
+
+	return Local_u32Freq;
+}
+
+u32 RCC_GetAHBClockFreq(void)
+{
+	/**< The prescaler is a power of two, a shift instead of a division */
+	return RCC_GetSystemClockFreq() >> RCC_AHBPrescalerShift[(RCC_CFGR_R >> RCC_HPRE_POS) & RCC_HPRE_MASK];
+}
+
+void RCC_EnableBackupDomainAccess(void)
+{
+	SET_BIT(RCC_APB1ENR_R, RCC_PWREN_BIT);
+	SET_BIT(RCC_APB1ENR_R, RCC_BKPEN_BIT);
+	SET_BIT(RCC_PWR_CR_R, RCC_PWR_DBP_BIT);
+}
+
+u8 RCC_StartRtcClock(u8 Copy_Source)
+{
+	u32 Local_u32Timeout = RCC_LSE_TIMEOUT;
+	u8 Local_u8Status = RCC_RTC_CLOCK_KEPT;
+
+	if ((Copy_Source < RCC_RTC_CLOCK_LSE) || (Copy_Source > RCC_RTC_CLOCK_HSE_DIV128))
+	{
+		return RCC_RTC_CLOCK_FAILED;
+	}
+
+	if (!GET_BIT(RCC_BDCR_R, RCC_RTCEN_BIT) || (((RCC_BDCR_R >> RCC_RTCSEL_POS) & RCC_RTCSEL_MASK) != Copy_Source))
+	{
+		/**< RTCSEL is written once, another source needs a backup domain reset */
+		if (((RCC_BDCR_R >> RCC_RTCSEL_POS) & RCC_RTCSEL_MASK) != 0)
+		{
+			SET_BIT(RCC_BDCR_R, RCC_BDRST_BIT);
+			CLR_BIT(RCC_BDCR_R, RCC_BDRST_BIT);
+		}
+		Local_u8Status = RCC_RTC_CLOCK_STARTED;
+	}
+
+	switch (Copy_Source)
+	{
+		case RCC_RTC_CLOCK_LSE:
+			SET_BIT(RCC_BDCR_R, RCC_LSEON_BIT);
+			while (!GET_BIT(RCC_BDCR_R, RCC_LSERDY_BIT) && (Local_u32Timeout > 0))
+			{
+				Local_u32Timeout--;
+			}
+		break;
+		case RCC_RTC_CLOCK_LSI:
+			/**< Not in the backup domain, it is off after every reset */
+			SET_BIT(RCC_CSR_R, RCC_LSION_BIT);
+			while (!GET_BIT(RCC_CSR_R, RCC_LSIRDY_BIT));
+		break;
+		default: /**< HSE is started by RCC_InitSysClock() */ break;
+	}
+
+	if (Local_u32Timeout == 0)
+	{
+		return RCC_RTC_CLOCK_FAILED;
+	}
+
+	if (Local_u8Status == RCC_RTC_CLOCK_STARTED)
+	{
+		RCC_BDCR_R |= (u32)Copy_Source << RCC_RTCSEL_POS;
+		SET_BIT(RCC_BDCR_R, RCC_RTCEN_BIT);
+	}
+
+	return Local_u8Status;
+}
+
+u32 RCC_GetAPB1TimerClockFreq(void)
+{
+	u8 Local_u8Ppre1 = (RCC_CFGR_R >> RCC_PPRE1_POS) & RCC_PPRE1_MASK;
+	u32 Local_u32Freq = RCC_GetAHBClockFreq();
+
+	/**< 0xx not divided, 100 /2 ... 111 /16; the timers get twice PCLK1 when it is divided */
+	if (Local_u8Ppre1 & 0x4)
+	{
+		Local_u32Freq = (Local_u32Freq >> ((Local_u8Ppre1 & 0x3) + 1)) * 2;
+	}
+
+	return Local_u32Freq;
+}
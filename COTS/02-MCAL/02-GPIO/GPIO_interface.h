@@ -145,4 +145,24 @@ void GPIO_SetPinValue(u8 Copy_PORT,u8 Copy_PIN, u8 Copy_Value);
  */
 u8  GPIO_GetPinValue(u8 Copy_PORT, u8 Copy_PIN);
 
+/**
+ * @brief Gets the address of the bit set/reset register (BSRR) of a specific port.
+ *
+ * Writing a 32-bit word to this register sets the pins whose bits are 1 in the low half-word and resets the pins
+ * whose bits are 1 in the high half-word, in one store and without read-modify-write. Drivers that toggle several
+ * pins of a port at high rate (parallel buses, multiplexed displays) keep this address and write to it directly.
+ *
+ * @param[in] Copy_PORT An 8-bit unsigned integer that represents the port. This parameter should be one of the following options: GPIO_PORTA, GPIO_PORTB, or GPIO_PORTC.
+ *
+ * @retval The address of the BSRR register of the port, or NULL if the port is not valid.
+ *
+ * @par Example:
+ *      To drive pins 0..7 of port B with the byte Data in one store, the following code can be used:
+ *      @code
+ *      volatile u32 *BSRR = GPIO_GetSetResetRegister(GPIO_PORTB);
+ *      *BSRR = (u32)Data | ((u32)(~Data & 0xFF) << 16);
+ *      @endcode
+ */
+volatile u32 *GPIO_GetSetResetRegister(u8 Copy_PORT);
+
 #endif /**< __GPIO_INTERFACE_H__ */
@@ -160,3 +160,18 @@ u8  MGPIO_u8GetPinValue(u8 Copy_PORT, u8 Copy_PIN)
 	}
 	return Local_u8ReturnPinValue;
 }
+
+volatile u32 *GPIO_GetSetResetRegister(u8 Copy_PORT)
+{
+	volatile u32 *Local_Register = NULL;
+	switch(Copy_PORT)
+	{
+		case GPIO_PORTA: Local_Register = &GPIOA_BSR_R; break;
+		case GPIO_PORTB: Local_Register = &GPIOB_BSR_R; break;
+		case GPIO_PORTC: Local_Register = &GPIOC_BSR_R; break;
+		default:
+			/**< RETURN ERROR STATUS */
+		break;
+	}
+	return Local_Register;
+}
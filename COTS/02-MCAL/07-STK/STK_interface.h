@@ -19,7 +19,7 @@
  *
  * This function initializes the SysTick timer with the specified reload value. The timer is configured to generate an interrupt
  * when it reaches zero, and then reloads the timer with the specified value. The interrupt can be used to implement a periodic
- * timebase for the application.
+ * timebase for the application. While the time base runs the SysTick is not stopped, see STK_StartTimeBase().
  *
  * @param[in] void.
  *
@@ -44,6 +44,7 @@ void STK_Start(void);
  * @brief Stops the SysTick timer.
  *
  * This function stops the SysTick timer. Once the timer is stopped, it will no longer count down or generate interrupts.
+ * The time base is paused, see STK_StartTimeBase().
  *
  * @param None.
  *
@@ -56,7 +57,8 @@ void STK_Stop(void);
  * @brief Resets the SysTick timer.
  *
  * This function disables the SysTick timer, clears the current value, sets the reload value to 0,
- * and clears the count flag.
+ * and clears the count flag. While the time base runs, only the interval and its callback are removed and the
+ * SysTick keeps counting with the longest period.
  *
  * @param None
  *
@@ -92,14 +94,28 @@ u32 STK_GetRemainingCounts(void);
  */
 u32 STK_GetElapsedCounts(void);
 
+/**
+ * @brief Gets the counts elapsed in the running interval.
+ *
+ * Unlike STK_GetElapsedCounts() the length of the running interval is the reload value it started with, so the
+ * result stays right when STK_SetNextInterval() already wrote the reload value of the next interval. Called first in
+ * the interval callback, it is the interrupt entry latency.
+ *
+ * @param None.
+ *
+ * @return The number of counts since the start of the running interval.
+ */
+u32 STK_GetIntervalElapsedCounts(void);
+
 /**
  * @brief Blocks the CPU for the specified number of microseconds.
  *
  * This function blocks the CPU for the specified number of microseconds using the SysTick timer. The function calculates the
- * number of ticks required to wait for the specified number of microseconds based on the current system clock frequency and
- * the reload value of the SysTick timer.
+ * number of ticks required to wait for the specified number of microseconds based on the configured AHB clock, with integer
+ * math only. A wait longer than the 24-bit reload is counted in several reload segments. While the time base runs, the
+ * SysTick is polled instead of being reprogrammed.
  *
- * @param[in] Copy_u32Microseconds The number of microseconds to wait. This value should be less than or equal to 16777215 (0x00FFFFFF).
+ * @param[in] Copy_u32Microseconds The number of microseconds to wait, any 32-bit value.
  *
  * @return None.
  */
@@ -109,15 +125,14 @@ void STK_SetBusyWait(u32 Copy_Microseconds);
 /**
  * @brief Blocks the CPU for the specified number of milliseconds.
  *
- * This function blocks the CPU for the specified number of microseconds using the SysTick timer. The function calculates the
- * number of ticks required to wait for the specified number of microseconds based on the current system clock frequency and
- * the reload value of the SysTick timer.
+ * This function blocks the CPU for the specified number of milliseconds using the SysTick timer, the same way as
+ * STK_SetBusyWait(). A 500 ms delay at 72 MHz on the processor clock (36,000,000 counts) takes three reload segments.
  *
- * @param[in] Copy_u32Milliseconds The number of milliseconds to wait. This value should be less than or equal to 16777215 (0x00FFFFFF).
+ * @param[in] Copy_u32Milliseconds The number of milliseconds to wait, any 32-bit value.
  *
  * @return None.
  */
-void STK_SetDelay(f32 Copy_Milliseconds);
+void STK_SetDelay(u32 Copy_Milliseconds);
 
 
 /**
@@ -128,7 +143,7 @@ void STK_SetDelay(f32 Copy_Milliseconds);
  * clock frequency and the reload value of the SysTick timer. When the requested delay has elapsed, the callback function will be
  * called.
  *
- * @param[in] Copy_u32Microseconds The number of microseconds to wait. This value should be less than or equal to 16777215 (0x00FFFFFF).
+ * @param[in] Copy_u32Microseconds The length of the interval in microseconds, any 32-bit value. An interval longer than the 24-bit reload is made of several reload segments, the callback is called after the last one.
  * @param[in] Copy_pfCallback The callback function to call when the requested delay has elapsed.
  *
  * @return None.
@@ -142,12 +157,110 @@ void STK_SetIntervalSingle(u32 Copy_Microseconds, void (*Copy_Callback)(void));
  * function calculates the number of ticks required to wait for the specified period based on the current system clock frequency
  * and the reload value of the SysTick timer. When the requested period has elapsed, the callback function will be called.
  *
- * @param[in] Copy_u32Microseconds The period of the callback function in microseconds. This value should be less than or equal to 16777215 (0x00FFFFFF).
+ * @param[in] Copy_u32Microseconds The period of the callback function in microseconds, any 32-bit value. A period longer than the 24-bit reload is made of several reload segments, the callback is called after the last one.
  * @param[in] Copy_pfCallback The callback function to call periodically.
  *
  * @return None.
  */
 void STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void));
 
+/**
+ * @brief Changes the length of the next periodic interval.
+ *
+ * This function writes the reload value only. The running interval is not affected, the SysTick takes the new value
+ * when it reaches zero, so calling it from the callback sets the length of the interval after the one that just started.
+ * This is how variable length periods (e.g. binary code modulation) are chained without restarting the timer.
+ * The next interval is one reload segment, it is cut to 2^24 counts.
+ *
+ * @param[in] Copy_Microseconds The length of the next interval in microseconds.
+ *
+ * @return None.
+ */
+void STK_SetNextInterval(u32 Copy_Microseconds);
+
+/**
+ * @brief Cancels the interval that calls a function, the other users of the SysTick keep it.
+ *
+ * Nothing is changed when Copy_Callback is not the function of the programmed interval. Otherwise the callback is
+ * removed and the SysTick is stopped, or kept counting with the longest period when the time base runs.
+ *
+ * @param[in] Copy_Callback The function given to STK_SetIntervalSingle() or STK_SetIntervalPeriodic().
+ *
+ * @return None.
+ */
+void STK_CancelInterval(void (*Copy_Callback)(void));
+
+/**
+ * @brief Starts the monotonic time base.
+ *
+ * The SysTick interrupt adds the length of every period that ends to a 64-bit count, so the time base keeps counting
+ * whatever periodic interval is programmed (the OS tick, STK_SetNextInterval() chains, ...). When the SysTick is not
+ * running it is started with the longest period (2^24 counts) and no callback. The count starts from 0 on the first
+ * call and never goes back: a call while the time base runs does nothing.
+ *
+ * While the time base runs, STK_Init(), the intervals and STK_Reset() keep the SysTick counting: a new interval starts
+ * right away from a count edge, and an ended single interval or a reset leaves the longest period without callback.
+ * Only STK_Stop() pauses the time base on its count; calling this function again resumes counting from there.
+ *
+ * @param None.
+ *
+ * @return None.
+ */
+void STK_StartTimeBase(void);
+
+/**
+ * @brief Gets the SysTick counts elapsed since STK_StartTimeBase().
+ *
+ * The read is lock-free: the values updated by the interrupt are read again when the interrupt ran in between,
+ * and a wrap whose interrupt is still pending (caller with the interrupts masked or with a higher priority) is
+ * accounted for. It can be called from tasks and interrupts.
+ *
+ * @param None.
+ *
+ * @return The number of SysTick counts as an unsigned 64-bit integer.
+ */
+u64 STK_GetTicks(void);
+
+/**
+ * @brief Gets the microseconds elapsed since STK_StartTimeBase().
+ *
+ * @param None.
+ *
+ * @return The number of microseconds as an unsigned 64-bit integer.
+ */
+u64 STK_GetMicros(void);
+
+/**
+ * @brief Skips periods of the running periodic interval, for a tickless idle.
+ *
+ * The running period keeps its remaining counts and is stretched by Copy_Intervals whole periods, so the next interrupt
+ * comes on the same time grid as without skipping and the callback is not called for the skipped periods. The SysTick is
+ * reprogrammed on a count edge, then the period reload is restored for the intervals after the stretched one. The time
+ * base keeps counting through it.
+ *
+ * @note Call it with the interrupts masked, just before WFI, then call STK_ResumeIntervals() after WFI.
+ * @note The reload register limits the stretch to 2^24 counts, the returned number may be less than requested.
+ * @note With STK_CTRL_CLKSOURCE_1 a count lasts one core cycle: the counts of the reprogramming are estimated from its
+ * instructions and taken from the stretched interval, the wake-up may be off by a few cycles.
+ *
+ * @param[in] Copy_Intervals The number of periods to skip.
+ *
+ * @return The number of periods skipped, 0 when the SysTick is not periodic or its interrupt is already pending.
+ */
+u32 STK_SkipIntervals(u32 Copy_Intervals);
+
+/**
+ * @brief Ends a stretched interval at the next period boundary, after a wake-up by another interrupt.
+ *
+ * Nothing is changed when the stretched interval already ended (its interrupt is pending) or ends within one period.
+ *
+ * @note Call it with the interrupts masked, right after WFI.
+ *
+ * @param None.
+ *
+ * @return The number of skipped periods that were given back, they will run as normal periods.
+ */
+u32 STK_ResumeIntervals(void);
+
 #endif /**<  __STK_INTERFACE_H__ */
 
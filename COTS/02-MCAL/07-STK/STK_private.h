@@ -35,6 +35,21 @@ typedef struct STK_RegDef_t{
 #define STK_CTRL_CLKSOURCE_MASK            0x00000004      /**< Bit 2 : Clock Source */
 #define STK_CTRL_COUNTFLAG_MASK            0x00010000      /**< Bit 16: Count Flag */
 
+/*********************< Interrupt control and state register, for the SysTick pending bit **********************/
+#define STK_SCB_ICSR                       (*((volatile u32 *)0xE000ED04U))
+#define STK_ICSR_PENDSTSET_MASK            0x04000000      /**< Bit 26: SysTick exception pending */
+
+/**
+ * @brief Critical section saving and restoring PRIMASK, for the time base updates outside the interrupt.
+ */
+#define STK_ENTER_CRITICAL(STATE)          __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (STATE) : : "memory")
+#define STK_EXIT_CRITICAL(STATE)           __asm volatile ("msr primask, %0" : : "r" (STATE) : "memory")
+
+/**
+ * @brief The longest SysTick period, the reload register is 24 bits wide.
+ */
+#define STK_MAX_RELOAD                     0x00FFFFFF
+
 
 /**
  * @brief Specifies the clock source for the SysTick timer.
@@ -50,6 +65,24 @@ typedef struct STK_RegDef_t{
 #define STK_CTRL_CLKSOURCE_1              1
 #define STK_CTRL_CLKSOURCE_8              0
 
+/**
+ * @brief Cutting an interval, see STK_CutInterval().
+ *
+ * STK_CUT_MARGIN: the counts left at least before an interval is cut, more than the counts spent between the first
+ * count edge and the reprogramming.
+ * STK_CUT_RELOAD_COUNTS: the counts from the last read of the counter to the reload that starts the new interval.
+ * With the processor clock / 8 the reprogramming fits in the count after the edge and the reload comes on the next
+ * edge. With the processor clock every cycle is a count: the reload comes after the load computation and the two
+ * register stores, the new interval is shortened by them and the time base adds them.
+ */
+#if STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_1
+#define STK_CUT_MARGIN                     64
+#define STK_CUT_RELOAD_COUNTS              6
+#else
+#define STK_CUT_MARGIN                     16
+#define STK_CUT_RELOAD_COUNTS              1
+#endif
+
 /**
  * @brief Specifies whether the SysTick timer exception request is enabled.
  *
@@ -70,24 +103,73 @@ typedef struct STK_RegDef_t{
 
 
 /**
- * @brief Sets the system clock frequency for the SysTick peripheral.
+ * @brief Gets the SysTick counts per millisecond.
  *
- * This function sets the system clock frequency for the SysTick peripheral. It does not allow changes to the values defined by the STK_CTRL_CLKSOURCE constant.
+ * The AHB clock is read from the RCC (divided by 8 with STK_CTRL_CLKSOURCE_8) on the first use and by STK_Init(),
+ * so the counts follow the configured system clock.
  *
- * @note
- * The available options for STK_CTRL_CLKSOURCE are:
- * - STK_CTRL_CLKSOURCE_1: Processor clock (AHB clock) divided by 1
- * - STK_CTRL_CLKSOURCE_8: Processor clock (AHB clock) divided by 8
+ * @return The number of counts per millisecond.
+ */
+static u32 STK_GetCountsPerMs(void);
+
+/**
+ * @brief Converts microseconds to SysTick counts, with integer math only.
  *
- * @retval None
+ * @param Copy_Microseconds The number of microseconds.
+ * @return The number of counts, rounded down.
  */
-#if STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_1
-    #define STK_AHB_CLK       8000000   /**< Processor clock (AHB clock) divided by 1 */
-#elif STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_8
-    #define STK_AHB_CLK       1000000   /**< Processor clock (AHB clock) divided by 8 */
-#else
-    #error "You chose a wrong clock source for the SysTick"
-#endif
+static u64 STK_MicrosecondsToCounts(u32 Copy_Microseconds);
+
+/**
+ * @brief Splits a number of counts in equal reload segments of at most 2^24 counts.
+ *
+ * @param Copy_Counts The number of counts, at least 2 are used.
+ * @param Copy_Wraps Returns the number of segments.
+ * @return The counts of a segment.
+ */
+static u32 STK_SplitCounts(u64 Copy_Counts, u32 *Copy_Wraps);
+
+/**
+ * @brief Programs an interval of any length and starts the SysTick with its interrupt.
+ *
+ * @param Copy_Counts The length of the interval in counts.
+ */
+static void STK_StartInterval(u64 Copy_Counts);
+
+/**
+ * @brief Waits for a number of counts, polling the time base when it runs or counting reload segments otherwise.
+ *
+ * @param Copy_Counts The number of counts.
+ */
+static void STK_WaitCounts(u64 Copy_Counts);
+
+/**
+ * @brief Waits for the next count edge of the SysTick.
+ *
+ * @return The counter value right after the edge.
+ */
+static u32 STK_SyncToCountEdge(void);
+
+/**
+ * @brief Ends the running period on a count edge and starts a new one, the interrupt comes Copy_Counts counts after the edge of Copy_Value.
+ *
+ * The counts spent since the edge of Copy_Value are read on a new edge and taken from the new interval, so neither the
+ * period grid nor the time base loses them.
+ *
+ * @param Copy_Value The counter value returned by STK_SyncToCountEdge(), at least STK_CUT_MARGIN.
+ * @param Copy_Counts The counts from the edge of Copy_Value to the interrupt, at least STK_CUT_MARGIN.
+ */
+static void STK_CutInterval(u32 Copy_Value, u32 Copy_Counts);
+
+/**
+ * @brief Stops the time base on the count it reached, called once the SysTick is stopped by STK_Stop().
+ */
+static void STK_PauseTimeBase(void);
+
+/**
+ * @brief Removes the programmed interval and its callback, the SysTick keeps counting with the longest period.
+ */
+static void STK_DropInterval(void);
 
 
 #endif /**< __STK_PRIVATE_H__ */
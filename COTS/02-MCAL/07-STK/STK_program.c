@@ -15,6 +15,7 @@
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
 /*********************< MCAL *********************/
+#include "RCC_interface.h"
 #include "STK_interface.h"
 #include "STK_config.h"
 #include "STK_private.h"
@@ -25,10 +26,33 @@ static void (*STK_Callback)(void) = NULL;
 /**< Define Variable for interval mode */
 static u8 STK_ModeOfInterval;
 
+/**< Time base: counts of the periods that ended; reload value of the running period, kept by the interrupt even without the time base */
+static volatile u64 STK_TimeBaseCounts = 0;
+static volatile u32 STK_CurrentLoad = 0;
+
+/**< Time base: incremented twice by each interrupt update, a reader that sees it change reads again */
+static volatile u32 STK_TimeSequence = 0;
+
+/**< Set while the time base owns the SysTick counting */
+static volatile u8 STK_TimeBaseRunning = 0;
+
+/**< Reload value of the periodic interval, restored after a stretched interval */
+static u32 STK_PeriodLoad = 0;
+
+/**< Reload segments of an interval, and the segments left before the callback */
+static u32 STK_PeriodWraps = 1;
+static volatile u32 STK_WrapsLeft = 1;
+
+/**< SysTick counts per millisecond, read from the RCC, 0 until then */
+static u32 STK_CountsPerMs = 0;
+
 void STK_Init(void)
 {
-    /**< Disable SysTick timer */
-    STK->CTRL &= ~STK_CTRL_ENABLE_MASK;
+    if (!STK_TimeBaseRunning)
+    {
+        /**< Disable SysTick timer, the time base keeps it counting */
+        STK->CTRL &= ~STK_CTRL_ENABLE_MASK;
+    }
 
     /**< Configure SysTick timer to use the processor clock */
     #if STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_1
@@ -43,10 +67,17 @@ void STK_Init(void)
     #if STK_CTRL_TICKINT == STK_CTRL_TICKINT_ENABLE
         STK->CTRL |= STK_CTRL_TICKINT_MASK;      /**< Set bit 1 to enable interrupt when the counter reaches zero */
     #elif STK_CTRL_TICKINT == STK_CTRL_TICKINT_DISABLE
-        STK->CTRL &= ~STK_CTRL_TICKINT_MASK;      /**< Clear bit 1 to enable interrupt when the counter reaches zero */
+        if (!STK_TimeBaseRunning)
+        {
+            STK->CTRL &= ~STK_CTRL_TICKINT_MASK;  /**< Clear bit 1 to enable interrupt when the counter reaches zero, the time base needs it */
+        }
     #else
         #error "WRONG OPTION"
     #endif
+
+    /**< The counts follow the clock actually configured */
+    STK_CountsPerMs = 0;
+    (void)STK_GetCountsPerMs();
 }
 
 void STK_Start(void)
@@ -59,10 +90,19 @@ void STK_Stop(void)
 {
     /**< Stop the SysTick timer */
     STK->CTRL &= ~STK_CTRL_ENABLE_MASK;
+
+    STK_PauseTimeBase();
 }
 
 void STK_Reset(void)
 {
+    if (STK_TimeBaseRunning)
+    {
+        /**< Only the interval is removed, the time base keeps the SysTick counting */
+        STK_DropInterval();
+        return;
+    }
+
     /**< Disable SysTick timer */
     STK->CTRL = 0;
     /**< Clear the current value */
@@ -87,28 +127,20 @@ u32 STK_GetElapsedCounts(void)
     return Local_u32ElapsedTicks;
 }
 
-void STK_SetBusyWait(u32 Copy_Microseconds)
+u32 STK_GetIntervalElapsedCounts(void)
 {
-    /**< Calculate the number of ticks required to wait for the specified number of microseconds */
-    u32 Local_u32Ticks = (Copy_Microseconds * STK_AHB_CLK) / 1000000;
-
-    /**< Wait for the specified number of ticks using the SysTick timer */
-    STK->LOAD = Local_u32Ticks;
-    STK->CTRL |= STK_CTRL_ENABLE_MASK;              /**< Enable SysTick timer */
-    while (!(STK->CTRL & STK_CTRL_COUNTFLAG_MASK)); /**< Wait until the SysTick timer reach to zero */
-    STK->CTRL &= ~STK_CTRL_ENABLE_MASK;             /**< Disable SysTick timer */
+    /**< The running period was loaded from the reload value its interrupt recorded, LOAD may already hold the next one */
+    return STK_CurrentLoad - STK->VAL;
 }
 
-void STK_SetDelay(f32 Copy_u32Milliseconds)
+void STK_SetBusyWait(u32 Copy_Microseconds)
 {
-    /**< Calculate the number of ticks required to wait for the specified number of microseconds */
-    u32 Local_u32Ticks = (Copy_u32Milliseconds * STK_AHB_CLK) / 1000.0;
+    STK_WaitCounts(STK_MicrosecondsToCounts(Copy_Microseconds));
+}
 
-    /**< Wait for the specified number of ticks using the SysTick timer */
-    STK->LOAD = Local_u32Ticks;
-    STK->CTRL |= STK_CTRL_ENABLE_MASK;              /**< Enable SysTick timer */
-    while (!(STK->CTRL & STK_CTRL_COUNTFLAG_MASK)); /**< Wait until the SysTick timer reach to zero */
-    STK->CTRL &= ~STK_CTRL_ENABLE_MASK;             /**< Disable SysTick timer */
+void STK_SetDelay(u32 Copy_Milliseconds)
+{
+    STK_WaitCounts((u64)Copy_Milliseconds * STK_GetCountsPerMs());
 }
 
 void STK_SetIntervalSingle(u32 Copy_u32Microseconds, void (*Copy_pfCallback)(void))
@@ -117,19 +149,12 @@ void STK_SetIntervalSingle(u32 Copy_u32Microseconds, void (*Copy_pfCallback)(voi
     {
         /**< Save the callback function pointer */
         STK_Callback = Copy_pfCallback;
-    
-        /* Calculate the number of ticks required to wait for the specified number of microseconds */
-        u32 Local_u32Ticks = (Copy_u32Microseconds * STK_AHB_CLK) / 1000000;
-    
-        /* Set the reload value for the SysTick timer */
-        STK->LOAD = Local_u32Ticks;
 
         /**< Set the Mode of interval to be single */
         STK_ModeOfInterval = STK_SINGLE_INTERVAL;
 
-        /* Start the SysTick timer and enable the interrupt */
-        STK->CTRL |= STK_CTRL_ENABLE_MASK;
-        STK->CTRL |= STK_CTRL_TICKINT_MASK; 
+        /**< Program the reload segments and start the SysTick timer with the interrupt */
+        STK_StartInterval(STK_MicrosecondsToCounts(Copy_u32Microseconds));
     }
     else
     {
@@ -145,18 +170,11 @@ void STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void))
         /**< Save the callback function pointer */
         STK_Callback = Copy_Callback;
 
-        /* Calculate the number of ticks required to wait for the specified number of microseconds */
-        u32 Local_u32Ticks = (Copy_Microseconds * STK_AHB_CLK) / 1000000;
-
-        /**< Set the reload value for the SysTick timer */
-        STK->LOAD = Local_u32Ticks;
-
         /**< Set the Mode of interval to be periodic */
         STK_ModeOfInterval = STK_PERIOD_INTERVAL;
 
-        /**< Start the SysTick timer */
-        STK->CTRL |= STK_CTRL_ENABLE_MASK;
-        STK->CTRL |= STK_CTRL_TICKINT_MASK;
+        /**< Program the reload segments and start the SysTick timer with the interrupt */
+        STK_StartInterval(STK_MicrosecondsToCounts(Copy_Microseconds));
     }
     else
     {
@@ -164,25 +182,402 @@ void STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void))
     }
 }
 
+void STK_SetNextInterval(u32 Copy_Microseconds)
+{
+    u64 Local_Counts = STK_MicrosecondsToCounts(Copy_Microseconds);
+
+    /**< One reload segment, longer next intervals are cut to the 24-bit reload */
+    if (Local_Counts > ((u64)STK_MAX_RELOAD + 1))
+    {
+        Local_Counts = (u64)STK_MAX_RELOAD + 1;
+    }
+    else if (Local_Counts < 2)
+    {
+        Local_Counts = 2;
+    }
+
+    /**< Only the reload value, the counter keeps running the current interval */
+    STK->LOAD = (u32)Local_Counts - 1;
+    STK_PeriodLoad = STK->LOAD;
+}
+
+void STK_CancelInterval(void (*Copy_Callback)(void))
+{
+    if ((Copy_Callback == NULL) || (STK_Callback != Copy_Callback))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    STK_DropInterval();
+
+    if (!STK_TimeBaseRunning)
+    {
+        STK_Stop();
+    }
+}
+
+void STK_StartTimeBase(void)
+{
+    u32 Local_State;
+
+    if (STK_TimeBaseRunning)
+    {
+        /**< Already counting, the count is never restarted */
+        return;
+    }
+
+    if (!(STK->CTRL & STK_CTRL_ENABLE_MASK))
+    {
+        /**< Nobody uses the SysTick, run it alone with the longest period */
+        STK_Init();
+        STK->LOAD = STK_MAX_RELOAD;
+        STK->VAL = 0;
+        STK->CTRL |= STK_CTRL_TICKINT_MASK;
+        STK->CTRL |= STK_CTRL_ENABLE_MASK;
+    }
+
+    STK_ENTER_CRITICAL(Local_State);
+
+    /**< Counting goes on from the paused count at the current position of the running period */
+    STK_TimeSequence++;
+    STK_CurrentLoad = STK->LOAD;
+    STK_TimeBaseCounts -= (u64)(STK_CurrentLoad - STK->VAL);
+    if (STK_SCB_ICSR & STK_ICSR_PENDSTSET_MASK)
+    {
+        /**< The pending interrupt adds the period that just started over */
+        STK_TimeBaseCounts -= (u64)STK_CurrentLoad + 1;
+    }
+    STK_TimeBaseRunning = 1;
+    STK_TimeSequence++;
+
+    STK_EXIT_CRITICAL(Local_State);
+}
+
+u64 STK_GetTicks(void)
+{
+    u32 Local_Sequence;
+    u64 Local_Counts;
+    u32 Local_Load;
+    u32 Local_Value;
+
+    do
+    {
+        Local_Sequence = STK_TimeSequence;
+        Local_Counts = STK_TimeBaseCounts;
+
+        /**< A paused time base holds its count */
+        if (STK_TimeBaseRunning)
+        {
+            Local_Load = STK_CurrentLoad;
+            Local_Value = STK->VAL;
+
+            if (STK_SCB_ICSR & STK_ICSR_PENDSTSET_MASK)
+            {
+                /**< Wrapped but the interrupt did not run yet: VAL is read again so it surely belongs to the new period */
+                Local_Value = STK->VAL;
+                Local_Counts += (u64)Local_Load + 1;
+                Local_Load = STK->LOAD;
+            }
+
+            Local_Counts += Local_Load - Local_Value;
+        }
+    } while (Local_Sequence != STK_TimeSequence);
+
+    return Local_Counts;
+}
+
+u64 STK_GetMicros(void)
+{
+    /**< Counts per millisecond keep the clocks that are not whole MHz (e.g. 4.5 MHz with the /8 source) exact */
+    return (STK_GetTicks() * 1000) / STK_GetCountsPerMs();
+}
+
+u32 STK_SkipIntervals(u32 Copy_Intervals)
+{
+    u32 Local_Period = STK_PeriodLoad + 1;
+    u32 Local_MaxIntervals = (STK_MAX_RELOAD + 1 - Local_Period) / Local_Period;
+    u32 Local_Value;
+
+    if ((STK_ModeOfInterval != STK_PERIOD_INTERVAL) || (STK_PeriodWraps != 1) || !(STK->CTRL & STK_CTRL_ENABLE_MASK) || (STK_SCB_ICSR & STK_ICSR_PENDSTSET_MASK))
+    {
+        /**< RETURN ERROR STATUS */
+        return 0;
+    }
+
+    if (Copy_Intervals > Local_MaxIntervals)
+    {
+        Copy_Intervals = Local_MaxIntervals;
+    }
+
+    Local_Value = STK_SyncToCountEdge();
+
+    if ((Copy_Intervals == 0) || (Local_Value < STK_CUT_MARGIN))
+    {
+        /**< The period ends now, let it */
+        return 0;
+    }
+
+    STK_CutInterval(Local_Value, Local_Value + (Copy_Intervals * Local_Period));
+
+    return Copy_Intervals;
+}
+
+u32 STK_ResumeIntervals(void)
+{
+    u32 Local_Period = STK_PeriodLoad + 1;
+    u32 Local_Value;
+    u32 Local_Counts;
+
+    if (STK_SCB_ICSR & STK_ICSR_PENDSTSET_MASK)
+    {
+        /**< Woken by the end of the stretched interval */
+        return 0;
+    }
+
+    Local_Value = STK_SyncToCountEdge();
+
+    /**< Counts to the next boundary of the period grid, which ends on the interrupt */
+    Local_Counts = Local_Value % Local_Period;
+    if (Local_Counts < STK_CUT_MARGIN)
+    {
+        Local_Counts += Local_Period;
+    }
+
+    if (Local_Counts >= Local_Value)
+    {
+        /**< No boundary before the end of the stretched interval */
+        return 0;
+    }
+
+    STK_CutInterval(Local_Value, Local_Counts);
+
+    return (Local_Value - Local_Counts) / Local_Period;
+}
+
 void SysTick_Handler(void)
 {
+    void (*Local_Callback)(void);
+
+    /**< Time base: add the period that just ended, the one that started was loaded from LOAD before any callback changes it */
+    STK_TimeSequence++;
+    if (STK_TimeBaseRunning)
+    {
+        STK_TimeBaseCounts += (u64)STK_CurrentLoad + 1;
+    }
+    STK_CurrentLoad = STK->LOAD;
+    STK_TimeSequence++;
+
+    /**< A long interval is made of several reload segments, the callback comes after the last one */
+    if (STK_WrapsLeft > 1)
+    {
+        STK_WrapsLeft--;
+        return;
+    }
+    STK_WrapsLeft = STK_PeriodWraps;
+
     /**< Call the callback function */
-    if (STK_Callback != NULL)
+    Local_Callback = STK_Callback;
+    if (Local_Callback != NULL)
     { 
         if(STK_ModeOfInterval == STK_SINGLE_INTERVAL)  
         {
+            /**< Stops the SysTick, or only removes the interval when the time base runs */
             STK_Reset();
         }
         /**< Callback notification */
-        STK_Callback();
+        Local_Callback();
 
         /**< Clear the count/interrupt flag */
         STK->CTRL &= ~STK_CTRL_COUNTFLAG_MASK;
     }
 }
 
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static u32 STK_SyncToCountEdge(void)
+{
+    u32 Local_First = STK->VAL;
+    u32 Local_Value;
+
+    /**< Right after the edge a full count is left to reprogram the SysTick without losing one */
+    do
+    {
+        Local_Value = STK->VAL;
+    } while (Local_Value == Local_First);
 
+    return Local_Value;
+}
 
+static void STK_CutInterval(u32 Copy_Value, u32 Copy_Counts)
+{
+    u32 Local_Value;
+
+    /**< The counts spent since the edge of Copy_Value are measured on a new edge and taken from the new interval */
+    Local_Value = STK_SyncToCountEdge();
+#if STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_1
+    /**< Every cycle is a count, read the counter again right before the stores */
+    Local_Value = STK->VAL;
+#else
+    /**< The rest of the count after the edge is enough for the stores */
+#endif
+    Copy_Counts -= (Copy_Value - Local_Value) + (STK_CUT_RELOAD_COUNTS - 1);
+
+    /**< Writing VAL clears it without interrupt, the next edge (STK_CUT_RELOAD_COUNTS after Local_Value) reloads the counter from LOAD */
+    STK->LOAD = Copy_Counts - 1;
+    STK->VAL = 0;
+    while (STK->VAL == 0);
 
+    /**< The intervals after this one are normal periods again */
+    STK->LOAD = STK_PeriodLoad;
 
+    /**< Time base: the running period ended on the reload edge, STK_CUT_RELOAD_COUNTS after Local_Value */
+    STK_TimeSequence++;
+    if (STK_TimeBaseRunning)
+    {
+        STK_TimeBaseCounts += (u64)(STK_CurrentLoad - Local_Value) + STK_CUT_RELOAD_COUNTS;
+    }
+    STK_CurrentLoad = Copy_Counts - 1;
+    STK_TimeSequence++;
+}
 
+static void STK_PauseTimeBase(void)
+{
+    u32 Local_State;
+    u64 Local_Counts;
+
+    if (!STK_TimeBaseRunning)
+    {
+        return;
+    }
+
+    /**< The SysTick is already stopped: the count read now, with a wrap still pending, is final */
+    STK_ENTER_CRITICAL(Local_State);
+    Local_Counts = STK_GetTicks();
+    STK_TimeSequence++;
+    STK_TimeBaseRunning = 0;
+    STK_TimeBaseCounts = Local_Counts;
+    STK_TimeSequence++;
+    STK_EXIT_CRITICAL(Local_State);
+}
+
+static void STK_DropInterval(void)
+{
+    STK_Callback = NULL;
+    STK_PeriodWraps = 1;
+    STK_WrapsLeft = 1;
+
+    /**< The time base still needs the interrupt, as rarely as possible from the next period */
+    STK->LOAD = STK_MAX_RELOAD;
+    STK_PeriodLoad = STK_MAX_RELOAD;
+}
+
+static u32 STK_GetCountsPerMs(void)
+{
+    if (STK_CountsPerMs == 0)
+    {
+        #if STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_1
+            STK_CountsPerMs = RCC_GetAHBClockFreq() / 1000;
+        #elif STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_8
+            STK_CountsPerMs = (RCC_GetAHBClockFreq() / 8) / 1000;
+        #else
+            #error "WRONG CHOICE FOR SYSTICK CLOCK SOURCE"
+        #endif
+    }
+
+    return STK_CountsPerMs;
+}
+
+static u64 STK_MicrosecondsToCounts(u32 Copy_Microseconds)
+{
+    u32 Local_CountsPerMs = STK_GetCountsPerMs();
+
+    /**< Whole milliseconds and the rest apart, the rest product fits 32 bits and the divisions are by constants */
+    return ((u64)(Copy_Microseconds / 1000) * Local_CountsPerMs) + (((Copy_Microseconds % 1000) * Local_CountsPerMs) / 1000);
+}
+
+static u32 STK_SplitCounts(u64 Copy_Counts, u32 *Copy_Wraps)
+{
+    u32 Local_Wraps = (u32)((Copy_Counts + STK_MAX_RELOAD) >> 24);
+    u32 Local_Segment;
+
+    if (Local_Wraps <= 1)
+    {
+        *Copy_Wraps = 1;
+        Local_Segment = (Copy_Counts < 2) ? 2 : (u32)Copy_Counts;
+    }
+    else
+    {
+        /**< Equal segments of 2^23 to 2^24 counts, rounded up: the interval is at most (wraps - 1) counts longer */
+        *Copy_Wraps = Local_Wraps;
+        Local_Segment = (u32)((Copy_Counts + Local_Wraps - 1) / Local_Wraps);
+    }
+
+    return Local_Segment;
+}
+
+static void STK_StartInterval(u64 Copy_Counts)
+{
+    u32 Local_Wraps;
+    u32 Local_Segment = STK_SplitCounts(Copy_Counts, &Local_Wraps);
+    u32 Local_State;
+    u32 Local_Value;
+
+    STK_PeriodWraps = Local_Wraps;
+    STK_WrapsLeft = Local_Wraps;
+
+    /**< Set the reload value for the SysTick timer, a running SysTick takes it at the end of its current period */
+    STK->LOAD = Local_Segment - 1;
+    STK_PeriodLoad = Local_Segment - 1;
+
+    if (!(STK->CTRL & STK_CTRL_ENABLE_MASK))
+    {
+        /**< A stopped counter reloads from LOAD on its first count */
+        STK->VAL = 0;
+        STK_CurrentLoad = Local_Segment - 1;
+    }
+    else if (STK_TimeBaseRunning)
+    {
+        /**< The counter runs a time base period (up to 2^24 counts): the interval starts now, not when that period ends */
+        STK_ENTER_CRITICAL(Local_State);
+        if (!(STK_SCB_ICSR & STK_ICSR_PENDSTSET_MASK))
+        {
+            Local_Value = STK_SyncToCountEdge();
+            if (Local_Value >= STK_CUT_MARGIN)
+            {
+                STK_CutInterval(Local_Value, (Local_Segment < STK_CUT_MARGIN) ? STK_CUT_MARGIN : Local_Segment);
+            }
+        }
+        STK_EXIT_CRITICAL(Local_State);
+    }
+
+    /* Start the SysTick timer and enable the interrupt */
+    STK->CTRL |= STK_CTRL_ENABLE_MASK;
+    STK->CTRL |= STK_CTRL_TICKINT_MASK;
+}
+
+static void STK_WaitCounts(u64 Copy_Counts)
+{
+    u32 Local_Wraps;
+    u32 Local_Segment;
+
+    if (STK_TimeBaseRunning)
+    {
+        /**< Do not reprogram the SysTick under the time base, poll it */
+        u64 Local_End = STK_GetTicks() + Copy_Counts;
+        while (STK_GetTicks() < Local_End);
+        return;
+    }
+
+    Local_Segment = STK_SplitCounts(Copy_Counts, &Local_Wraps);
+
+    /**< Wait for the segments using the SysTick timer, COUNTFLAG is cleared by each read that returns it set */
+    STK->LOAD = Local_Segment - 1;
+    STK->VAL = 0;
+    STK->CTRL |= STK_CTRL_ENABLE_MASK;              /**< Enable SysTick timer */
+    while (Local_Wraps > 0)
+    {
+        while (!(STK->CTRL & STK_CTRL_COUNTFLAG_MASK)); /**< Wait until the SysTick timer reach to zero */
+        Local_Wraps--;
+    }
+    STK->CTRL &= ~STK_CTRL_ENABLE_MASK;             /**< Disable SysTick timer */
+}
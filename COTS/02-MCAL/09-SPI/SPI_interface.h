@@ -293,6 +293,75 @@ void SPI_voidInit(SPI_t Copy_SelectedSPI, const SPI_config_t *Copy_SPIConfig);
  */
 void SPI_voidTransfer(SPI_t Copy_SPI, u8 *Copy_TxData, u8 *Copy_RxData, u16 Copy_Size);
 
+/**
+ * @brief Perform a transmit-only SPI burst.
+ *
+ * This function sends an array of data bytes back-to-back using the SPI peripheral, feeding the data
+ * register as soon as the transmit buffer is empty. The bytes shifted in during the burst are discarded,
+ * so no receive buffer is needed and the bus is never stalled waiting for RXNE between bytes.
+ *
+ * @param[in] Copy_SPI The SPI peripheral to perform the transmission.
+ * @param[in] Copy_TxData Pointer to the array of data bytes to be transmitted.
+ * @param[in] Copy_Size The number of data bytes to be transmitted.
+ *
+ * @return None.
+ *
+ * @note This function blocks until the last byte has left the shift register, so the caller may release
+ *       its chip select line right after it returns. Any overrun raised by the ignored received bytes is
+ *       cleared before returning.
+ *
+ * @note Example Usage:
+ * @code
+ * /// Select the SPI peripheral (e.g., SPI1)
+ * SPI_t spi_selected = SPI_SelectSpiPeripheral(SPI1);
+ *
+ * /// Stream a block of pixel data to a display
+ * u8 pixels[] = {0xF8, 0x00, 0xF8, 0x00};
+ * SPI_voidTransmit(spi_selected, pixels, sizeof(pixels));
+ * @endcode
+ */
+void SPI_voidTransmit(SPI_t Copy_SPI, const u8 *Copy_TxData, u16 Copy_Size);
+
+/**
+ * @brief Feed bytes to the SPI peripheral without touching the slave select or waiting for the bus.
+ *
+ * This function writes each byte as soon as the transmit buffer is empty and returns once the last byte
+ * has been handed to the peripheral, so consecutive calls keep the bus busy with no gap between them.
+ * The caller owns the chip select line and calls SPI_voidWaitIdle once at the end of the stream.
+ *
+ * @param[in] Copy_SPI The SPI peripheral to perform the transmission.
+ * @param[in] Copy_TxData Pointer to the array of data bytes to be transmitted.
+ * @param[in] Copy_Size The number of data bytes to be transmitted.
+ *
+ * @return None.
+ *
+ * @note The last bytes may still be shifting out when this function returns, do not release the chip
+ *       select or change a data/command line before SPI_voidWaitIdle returns.
+ *
+ * @note Example Usage:
+ * @code
+ * /// Stream two blocks to a display selected by its own chip select pin
+ * GPIO_SetPinValue(GPIO_PORTB, GPIO_PIN0, GPIO_LOW);
+ * SPI_voidStream(spi_selected, block1, sizeof(block1));
+ * SPI_voidStream(spi_selected, block2, sizeof(block2));
+ * SPI_voidWaitIdle(spi_selected);
+ * GPIO_SetPinValue(GPIO_PORTB, GPIO_PIN0, GPIO_HIGH);
+ * @endcode
+ */
+void SPI_voidStream(SPI_t Copy_SPI, const u8 *Copy_TxData, u16 Copy_Size);
+
+/**
+ * @brief Wait for the SPI peripheral to finish the bytes already written.
+ *
+ * This function waits for the transmit buffer to empty and the busy flag to clear, then drops the last
+ * received byte and clears the overrun raised by the ignored received bytes.
+ *
+ * @param[in] Copy_SPI The SPI peripheral to wait for.
+ *
+ * @return None.
+ */
+void SPI_voidWaitIdle(SPI_t Copy_SPI);
+
 /**
  * @} SPI_Functions
  */
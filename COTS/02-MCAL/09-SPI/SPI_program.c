@@ -151,6 +151,46 @@ void SPI_voidTransfer(SPI_t Copy_SPI, u8 *Copy_TxData, u8 *Copy_RxData, u16 Copy
 
 }
 
+void SPI_voidTransmit(SPI_t Copy_SPI, const u8 *Copy_TxData, u16 Copy_Size)
+{
+  #if SPI_MODE == SPI_MASTER_MODE
+    /**< Clear the slave select pin -> Enable the slave select pin */
+    GPIO_SetPinValue(GPIO_PORTA, GPIO_PIN4, GPIO_LOW);
+  #endif
+
+  /**< Send the bytes back to back then wait once for the bus to go idle */
+  SPI_voidStream(Copy_SPI, Copy_TxData, Copy_Size);
+  SPI_voidWaitIdle(Copy_SPI);
+
+  #if SPI_MODE == SPI_MASTER_MODE
+    /* Set the slave select pin -> Disable the slave select pin */
+    GPIO_SetPinValue(GPIO_PORTA, GPIO_PIN4, GPIO_HIGH);
+  #endif
+}
+
+void SPI_voidStream(SPI_t Copy_SPI, const u8 *Copy_TxData, u16 Copy_Size)
+{
+  /**< Iterator to loop on the data */
+  u16 Local_Iterator;
+
+  /**< Keep the transmit buffer fed, the received bytes are not needed */
+  for (Local_Iterator = 0; Local_Iterator < Copy_Size; Local_Iterator++)
+  {
+    SPI_SendByte(Copy_SPI, Copy_TxData[Local_Iterator]);
+  }
+}
+
+void SPI_voidWaitIdle(SPI_t Copy_SPI)
+{
+  /**< Wait for the last byte to be moved to the shift register then for the transmission to complete */
+  while (!GET_BIT(Copy_SPI->SR, SPI_SR_TXE));
+  SPI_WaitForTransmissionComplete(Copy_SPI);
+
+  /**< Drop the last received byte and clear the overrun flag (read DR then SR) */
+  (void)Copy_SPI->DR;
+  (void)Copy_SPI->SR;
+}
+
 /**
  * @} SPI_Functions
  */
@@ -0,0 +1,75 @@
+/**
+ ********************************************************************************************************************************** 
+ * @file UART_BRR_test.c
+ * @brief Host check of the integer baud rate register value against the floating point computation.
+ * @date 19 Oct 2026
+ * @version V01
+ ********************************************************************************************************************************** 
+ * @details UART_BRR_VALUE() replaced the f32 USARTDIV computation of UART_Init(). This program computes BRR both ways,
+ * for every baud rate of UART_BaudRate_t at 8, 36 and 72 MHz, and fails on the first difference.
+ * It runs on the host, not on the target:
+ *
+ * @code
+ * gcc -I../../01-LIB -o UART_BRR_test UART_BRR_test.c && ./UART_BRR_test
+ * @endcode
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************************************************** 
+ */
+
+#include <stdio.h>
+
+/*********************< LIB *********************/
+#include "STD_TYPES.h"
+/*********************< MCAL *********************/
+#include "UART_private.h"
+
+/**< The clocks of the USART peripherals to check */
+static const u32 UART_TestClocks[] = { 8000000UL, 36000000UL, 72000000UL };
+
+/**< The baud rates of UART_BaudRate_t */
+static const u32 UART_TestBaudRates[] = { 9600UL, 115200UL, 57600UL, 38400UL };
+
+/**
+ * @brief The BRR value computed as UART_Init() did before, with f32 USARTDIV.
+ */
+static u16 UART_FloatBRR(u32 Copy_Clock, u32 Copy_BaudRate)
+{
+  f32 Local_f32USARTDIV = (f32)Copy_Clock / (16 * Copy_BaudRate);
+  u16 Local_u16DIV_Mantissa = (u16)Local_f32USARTDIV;
+  u16 Local_u16DIV_Fraction = (u16)(((Local_f32USARTDIV - Local_u16DIV_Mantissa) * 16) + 0.5);
+
+  if (Local_u16DIV_Fraction >= 16)
+  {
+    Local_u16DIV_Fraction -= 16;
+    Local_u16DIV_Mantissa += 1;
+  }
+
+  return (Local_u16DIV_Mantissa << 4) | Local_u16DIV_Fraction;
+}
+
+int main(void)
+{
+  u8 Local_Failures = 0;
+
+  for (u8 Local_ClockIterator = 0; Local_ClockIterator < sizeof(UART_TestClocks) / sizeof(UART_TestClocks[0]); Local_ClockIterator++)
+  {
+    for (u8 Local_RateIterator = 0; Local_RateIterator < sizeof(UART_TestBaudRates) / sizeof(UART_TestBaudRates[0]); Local_RateIterator++)
+    {
+      u32 Local_Clock = UART_TestClocks[Local_ClockIterator];
+      u32 Local_BaudRate = UART_TestBaudRates[Local_RateIterator];
+      u16 Local_Expected = UART_FloatBRR(Local_Clock, Local_BaudRate);
+      u16 Local_Actual = UART_BRR_VALUE(Local_Clock, Local_BaudRate);
+
+      printf("%8lu Hz %6lu baud: float 0x%04X integer 0x%04X %s\n", (unsigned long)Local_Clock, (unsigned long)Local_BaudRate,
+             Local_Expected, Local_Actual, (Local_Expected == Local_Actual) ? "OK" : "MISMATCH");
+
+      if (Local_Expected != Local_Actual)
+      {
+        Local_Failures++;
+      }
+    }
+  }
+
+  return (Local_Failures == 0) ? 0 : 1;
+}
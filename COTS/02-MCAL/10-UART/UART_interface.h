@@ -216,6 +216,8 @@ USART_RegDef_t *UART_GetUSARTBaseAddress(USART_Selection_t usart);
  *
  * @retval None
  *
+ * @note Nothing is configured when a pointer is NULL or the baud rate is not one of UART_BaudRate_t.
+ *
  * @note Example Usage:
  * @code
  * /**< Choose the USART peripheral you want to use (in this case, USART1)
@@ -237,6 +239,20 @@ USART_RegDef_t *UART_GetUSARTBaseAddress(USART_Selection_t usart);
  */
 void UART_Init(USART_RegDef_t *Copy_USART, UART_Config_t *config);
 
+/**
+ * @brief Set a baud rate that is not one of UART_BaudRate_t.
+ *
+ * The divisor is computed with integer arithmetic only, it equals the rounded USARTDIV mantissa and fraction.
+ *
+ * @param[in] Copy_USART Pointer to the USART peripheral structure.
+ * @param[in] Copy_BaudRate The baud rate in bits per second, from USART_CLK_SRC / 65535 to USART_CLK_SRC / 16.
+ *
+ * @retval None
+ *
+ * @note A baud rate out of range leaves BRR unchanged.
+ */
+void UART_SetBaudRate(USART_RegDef_t *Copy_USART, u32 Copy_BaudRate);
+
 /**
  * @brief Transmit data through the UART peripheral.
  *
@@ -161,6 +161,15 @@ USART_RegDef_t *UART_GetUSARTBaseAddress(USART_Selection_t usart)
 #define USART_SR_FE         0x00000002 /**< Framing error */
 #define USART_SR_PE         0x00000001 /**< Parity error */
 
+/**
+ * @brief Baud rate register value for a clock and a baud rate.
+ *
+ * BRR holds USARTDIV = CLK / (16 * BAUD) as 12.4 fixed point (mantissa and fraction), so the register value
+ * is CLK / BAUD rounded to the nearest integer: the rounded fraction and its carry into the mantissa in one
+ * integer division. With constant arguments the compiler computes it.
+ */
+#define UART_BRR_VALUE(CLK, BAUD)   (((CLK) + ((BAUD) / 2)) / (BAUD))
+
 #endif /* __UART_PRIVATE_H__ */
 
 /**
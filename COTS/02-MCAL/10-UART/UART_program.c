@@ -37,8 +37,29 @@
 #include "UART_private.h"
 #include "UART_interface.h"
 
+/**< The standard baud rates must fit the 12-bit mantissa (at least 1) of BRR with this clock */
+#if (UART_BRR_VALUE(USART_CLK_SRC, 115200UL) < 16) || (UART_BRR_VALUE(USART_CLK_SRC, 9600UL) > 0xFFFF)
+  #error "USART_CLK_SRC DOES NOT SUPPORT THE STANDARD BAUD RATES"
+#endif
+
+/**< BRR values of UART_BaudRate_t, in its order */
+static const u16 UART_BaudRateRegisters[] =
+{
+  UART_BRR_VALUE(USART_CLK_SRC, 9600UL),
+  UART_BRR_VALUE(USART_CLK_SRC, 115200UL),
+  UART_BRR_VALUE(USART_CLK_SRC, 57600UL),
+  UART_BRR_VALUE(USART_CLK_SRC, 38400UL)
+};
+
 void UART_Init(USART_RegDef_t *Copy_USART, UART_Config_t *config)
 {
+  if ((Copy_USART == NULL) || (config == NULL) ||
+      (config->BaudRate >= (sizeof(UART_BaudRateRegisters) / sizeof(UART_BaudRateRegisters[0]))))
+  {
+    /**< RETURN ERROR STATUS */
+    return;
+  }
+
   /**< Configure UART word length (data bits) */
   if (config->WordLength == UART_WORD_LENGTH_8BIT)
   {
@@ -99,35 +120,35 @@ void UART_Init(USART_RegDef_t *Copy_USART, UART_Config_t *config)
   }
 
   /*********************< Configure UART baud rate *********************/
-  /**< Calculate the value of the USARTDIV register based on the desired baud rate */
-  f32 Local_f32USARTDIV = (f32)USART_CLK_SRC / (16 * config->BaudRate);
+  /**< The mantissa and fraction of USARTDIV for the selected baud rate, computed at compile time */
+  Copy_USART->BRR = UART_BaudRateRegisters[config->BaudRate];
+
+  /**< Enable UART */
+  Copy_USART->CR1 |= USART_CR1_UE;  /**< Set the UE bit to enable UART */ 
+}
 
-  /**< Calculate the integer (mantissa) and fractional parts of USARTDIV */
-  u16 Local_u16DIV_Mantissa = (u16)Local_f32USARTDIV;
-  u16 Local_u16DIV_Fraction = (u16)(((Local_f32USARTDIV - Local_u16DIV_Mantissa) * 16) + 0.5);
+void UART_SetBaudRate(USART_RegDef_t *Copy_USART, u32 Copy_BaudRate)
+{
+  u32 Local_BRR;
 
-  /**< Check if the fractional part requires carrying */
-  u8 Local_u8Carry = 0;
-  if (Local_u16DIV_Fraction >= 16)
+  if (Copy_BaudRate == 0)
   {
-    Local_u16DIV_Fraction -= 16;
-    Local_u8Carry = 1;
+    /**< RETURN ERROR STATUS */
+    return;
   }
 
-  /**< Adjust the mantissa if carry is required */
-  if (Local_u8Carry == 1)
+  /**< Integer rounding of CLK / BAUD, the same value as the rounded 12.4 fixed point USARTDIV */
+  Local_BRR = UART_BRR_VALUE((u32)USART_CLK_SRC, Copy_BaudRate);
+
+  if ((Local_BRR < 16) || (Local_BRR > 0xFFFF))
   {
-    Local_u16DIV_Mantissa += 1;
+    /**< RETURN ERROR STATUS */
+    return;
   }
 
-  /**< Configure the Baud Rate Register (BRR) with calculated values */
-  Copy_USART->BRR = (Local_u16DIV_Mantissa << 4) | Local_u16DIV_Fraction;
-
-  /**< Enable UART */
-  Copy_USART->CR1 |= USART_CR1_UE;  /**< Set the UE bit to enable UART */ 
+  Copy_USART->BRR = Local_BRR;
 }
 
-
 void UART_Transmit(USART_RegDef_t *Copy_USART, u8* data, u16 size)
 {
   /**< Wait until the transmit buffer is empty */ 
@@ -0,0 +1,23 @@
+/**
+ ********************************************************************************************
+ * @file DWT_config.h
+ * @brief This file contains the configuration of the DWT cycle counter driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __DWT_CONFIG_H__
+#define __DWT_CONFIG_H__
+
+/**
+ * @brief The longest wait in one run of the cycle counter, in microseconds.
+ *
+ * Longer delays are split so the cycle count of a part always fits 32 bits (2^32 cycles is 59 s at 72 MHz).
+ * It must be a whole number of milliseconds.
+ */
+#define DWT_CHUNK_US                1000000UL
+
+#endif /**< __DWT_CONFIG_H__ */
@@ -0,0 +1,86 @@
+/**
+ ********************************************************************************************
+ * @file DWT_interface.h
+ * @brief This file contains the interface of the DWT cycle counter driver.
+ *
+ * The cycle counter of the Cortex-M3 Data Watchpoint and Trace unit counts the core clock cycles. It gives 32-bit
+ * timestamps and busy waits of cycles, microseconds or nanoseconds without touching the SysTick, so the delays do
+ * not disturb a running interval and can be used from interrupts.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __DWT_INTERFACE_H__
+#define __DWT_INTERFACE_H__
+
+/**
+ * @addtogroup DWT_Functions
+ * @{
+ */
+
+/**
+ * @brief Enables the cycle counter and reads the core clock.
+ *
+ * The delays convert with the core clock read here from the RCC (in cycles per millisecond), call it again after
+ * changing the clock. The other functions call it on their first use.
+ *
+ * @retval None
+ */
+void DWT_Init(void);
+
+/**
+ * @brief Gets the cycle counter.
+ *
+ * The difference of two timestamps (unsigned, modulo 2^32) is the number of cycles between them, correct for
+ * intervals up to 2^32 cycles (59 s at 72 MHz).
+ *
+ * @return The number of core cycles, wrapping at 2^32.
+ */
+u32 DWT_GetCycles(void);
+
+/**
+ * @brief Converts a number of cycles to microseconds.
+ *
+ * @param[in] Copy_Cycles The number of cycles.
+ * @return The number of whole microseconds.
+ */
+u32 DWT_CyclesToUs(u32 Copy_Cycles);
+
+/**
+ * @brief Waits for a number of core cycles.
+ *
+ * @param[in] Copy_Cycles The number of cycles, the call overhead is included.
+ * @retval None
+ */
+void DWT_DelayCycles(u32 Copy_Cycles);
+
+/**
+ * @brief Waits for a number of nanoseconds, rounded up to a whole cycle.
+ *
+ * @param[in] Copy_Nanoseconds The number of nanoseconds.
+ * @retval None
+ */
+void DWT_DelayNs(u32 Copy_Nanoseconds);
+
+/**
+ * @brief Waits for a number of microseconds.
+ *
+ * @param[in] Copy_Microseconds The number of microseconds, any 32-bit value.
+ * @retval None
+ */
+void DWT_DelayUs(u32 Copy_Microseconds);
+
+/**
+ * @brief Waits for a number of milliseconds.
+ *
+ * @param[in] Copy_Milliseconds The number of milliseconds, any 32-bit value.
+ * @retval None
+ */
+void DWT_DelayMs(u32 Copy_Milliseconds);
+
+/** @} DWT_Functions */
+
+#endif /**< __DWT_INTERFACE_H__ */
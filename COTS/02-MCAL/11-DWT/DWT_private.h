@@ -0,0 +1,43 @@
+/**
+ ********************************************************************************************
+ * @file DWT_private.h
+ * @brief This file contains the private definitions of the DWT cycle counter driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __DWT_PRIVATE_H__
+#define __DWT_PRIVATE_H__
+
+/**
+ * @brief DWT registers used by the driver.
+ */
+typedef struct
+{
+    volatile u32 CTRL;      /**< Control register */
+    volatile u32 CYCCNT;    /**< Cycle count register */
+} DWT_RegDef_t;
+
+#define DWT_BASE_ADDRESS            0xE0001000U
+#define DWT                         ((DWT_RegDef_t *)DWT_BASE_ADDRESS)
+
+#define DWT_CTRL_CYCCNTENA_MASK     0x00000001      /**< Bit 0: Cycle counter enable */
+
+/**
+ * @brief Debug exception and monitor control register, its TRCENA bit powers the DWT.
+ */
+#define DWT_DEMCR                   (*((volatile u32 *)0xE000EDFCU))
+#define DWT_DEMCR_TRCENA_MASK       0x01000000      /**< Bit 24: Trace enable */
+
+/**
+ * @brief Waits until a number of cycles passed since a timestamp.
+ *
+ * @param Copy_Start The timestamp.
+ * @param Copy_Cycles The number of cycles.
+ */
+static void DWT_WaitFrom(u32 Copy_Start, u32 Copy_Cycles);
+
+#endif /**< __DWT_PRIVATE_H__ */
@@ -0,0 +1,138 @@
+/**
+ ********************************************************************************************
+ * @file DWT_program.c
+ * @brief This file contains the implementation of the DWT cycle counter driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "RCC_interface.h"
+#include "DWT_interface.h"
+#include "DWT_config.h"
+#include "DWT_private.h"
+
+#if ((DWT_CHUNK_US % 1000) != 0) || (DWT_CHUNK_US == 0)
+#error "DWT_CHUNK_US must be a whole number of milliseconds"
+#endif
+
+/**< Core cycles per millisecond, 0 until DWT_Init() */
+static u32 DWT_CyclesPerMs = 0;
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void DWT_Init(void)
+{
+    DWT_DEMCR |= DWT_DEMCR_TRCENA_MASK;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_MASK;
+
+    /**< Per millisecond, so the clocks below 1 MHz and the ones that are not whole MHz (e.g. 4.5 MHz) stay exact */
+    DWT_CyclesPerMs = RCC_GetAHBClockFreq() / 1000;
+}
+
+u32 DWT_GetCycles(void)
+{
+    if (DWT_CyclesPerMs == 0)
+    {
+        DWT_Init();
+    }
+
+    return DWT->CYCCNT;
+}
+
+u32 DWT_CyclesToUs(u32 Copy_Cycles)
+{
+    if (DWT_CyclesPerMs == 0)
+    {
+        DWT_Init();
+    }
+
+    /**< Whole milliseconds and the rest apart, the rest product fits 32 bits */
+    return ((Copy_Cycles / DWT_CyclesPerMs) * 1000) + (((Copy_Cycles % DWT_CyclesPerMs) * 1000) / DWT_CyclesPerMs);
+}
+
+void DWT_DelayCycles(u32 Copy_Cycles)
+{
+    if (DWT_CyclesPerMs == 0)
+    {
+        DWT_Init();
+    }
+
+    DWT_WaitFrom(DWT->CYCCNT, Copy_Cycles);
+}
+
+void DWT_DelayNs(u32 Copy_Nanoseconds)
+{
+    u32 Local_Start = DWT->CYCCNT;
+    u32 Local_Rest;
+    u32 Local_UsCycles;
+    u32 Local_Cycles;
+
+    if (DWT_CyclesPerMs == 0)
+    {
+        DWT_Init();
+        Local_Start = DWT->CYCCNT;
+    }
+
+    /**< Whole milliseconds, whole microseconds and nanoseconds apart, so no product overflows 32 bits */
+    Local_Rest = Copy_Nanoseconds % 1000000UL;
+    Local_UsCycles = (Local_Rest / 1000) * DWT_CyclesPerMs;     /**< Thousandths of cycles */
+    Local_Cycles = ((Copy_Nanoseconds / 1000000UL) * DWT_CyclesPerMs) + (Local_UsCycles / 1000)
+                 + ((((Local_UsCycles % 1000) * 1000) + ((Local_Rest % 1000) * DWT_CyclesPerMs) + 999999UL) / 1000000UL);
+
+    DWT_WaitFrom(Local_Start, Local_Cycles);
+}
+
+void DWT_DelayUs(u32 Copy_Microseconds)
+{
+    u32 Local_Start = DWT->CYCCNT;
+    u32 Local_ChunkCycles;
+
+    if (DWT_CyclesPerMs == 0)
+    {
+        DWT_Init();
+        Local_Start = DWT->CYCCNT;
+    }
+
+    /**< Each part starts where the previous one ended, the parts do not add up errors */
+    Local_ChunkCycles = (DWT_CHUNK_US / 1000) * DWT_CyclesPerMs;
+    while (Copy_Microseconds > DWT_CHUNK_US)
+    {
+        DWT_WaitFrom(Local_Start, Local_ChunkCycles);
+        Local_Start += Local_ChunkCycles;
+        Copy_Microseconds -= DWT_CHUNK_US;
+    }
+
+    DWT_WaitFrom(Local_Start, ((Copy_Microseconds / 1000) * DWT_CyclesPerMs) + ((((Copy_Microseconds % 1000) * DWT_CyclesPerMs) + 999) / 1000));
+}
+
+void DWT_DelayMs(u32 Copy_Milliseconds)
+{
+    u32 Local_Start = DWT->CYCCNT;
+
+    if (DWT_CyclesPerMs == 0)
+    {
+        DWT_Init();
+        Local_Start = DWT->CYCCNT;
+    }
+
+    while (Copy_Milliseconds > 0)
+    {
+        DWT_WaitFrom(Local_Start, DWT_CyclesPerMs);
+        Local_Start += DWT_CyclesPerMs;
+        Copy_Milliseconds--;
+    }
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void DWT_WaitFrom(u32 Copy_Start, u32 Copy_Cycles)
+{
+    /**< The unsigned difference is right across the counter wrap */
+    while ((DWT->CYCCNT - Copy_Start) < Copy_Cycles);
+}
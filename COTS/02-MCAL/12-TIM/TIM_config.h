@@ -0,0 +1,23 @@
+/**
+ ********************************************************************************************
+ * @file TIM_config.h
+ * @brief This file contains the configuration of the general purpose timers driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TIM_CONFIG_H__
+#define __TIM_CONFIG_H__
+
+/**
+ * @brief The input capture digital filter, 0 to 15 (ICxF).
+ *
+ * 0 captures the first sample of an edge; higher values need more equal samples, which rejects glitches of the
+ * input (e.g. 3: 8 samples at the timer clock).
+ */
+#define TIM_CAPTURE_FILTER          0
+
+#endif /**< __TIM_CONFIG_H__ */
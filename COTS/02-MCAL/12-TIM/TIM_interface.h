@@ -0,0 +1,241 @@
+/**
+ ********************************************************************************************
+ * @file TIM_interface.h
+ * @brief This file contains the interface of the general purpose timers driver (TIM2 to TIM4).
+ *
+ * Each timer is a 16-bit up-counter with a prescaler and 4 capture/compare channels. The driver provides periodic
+ * update interrupts, PWM, input capture extended to 32 bits by counting the overflows, one-pulse mode and the DMA
+ * request enables.
+ *
+ * @note The timer clock (RCC APB1) and its NVIC line (NVIC_TIM2_IRQn ...) are enabled by the application, like for the
+ * other peripherals. The channel pins are set as alternate function outputs for PWM and as inputs for capture.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TIM_INTERFACE_H__
+#define __TIM_INTERFACE_H__
+
+/**
+ * @addtogroup TIM_Types
+ * @{
+ */
+
+/**
+ * @brief The general purpose timers.
+ */
+typedef enum
+{
+    TIM2,       /**< TIM2, channels on PA0 to PA3 */
+    TIM3,       /**< TIM3, channels on PA6, PA7, PB0, PB1 */
+    TIM4        /**< TIM4, channels on PB6 to PB9 */
+} TIM_Peripheral_t;
+
+/**
+ * @brief The capture/compare channels.
+ */
+typedef enum
+{
+    TIM_CHANNEL1,
+    TIM_CHANNEL2,
+    TIM_CHANNEL3,
+    TIM_CHANNEL4
+} TIM_Channel_t;
+
+/**
+ * @brief The PWM output polarity.
+ */
+typedef enum
+{
+    TIM_PWM_ACTIVE_HIGH,    /**< The output is high for the compare value counts of each period */
+    TIM_PWM_ACTIVE_LOW      /**< The output is low for the compare value counts of each period */
+} TIM_PwmPolarity_t;
+
+/**
+ * @brief The input capture edge.
+ */
+typedef enum
+{
+    TIM_CAPTURE_RISING,     /**< Capture on the rising edges */
+    TIM_CAPTURE_FALLING     /**< Capture on the falling edges */
+} TIM_CaptureEdge_t;
+
+/**
+ * @brief DMA requests of TIM_EnableDmaRequests(), they can be combined.
+ */
+#define TIM_DMA_UPDATE          0x0100      /**< UDE: request on each update (overflow) */
+#define TIM_DMA_CC1             0x0200      /**< CC1DE: request on each channel 1 compare or capture */
+#define TIM_DMA_CC2             0x0400      /**< CC2DE: request on each channel 2 compare or capture */
+#define TIM_DMA_CC3             0x0800      /**< CC3DE: request on each channel 3 compare or capture */
+#define TIM_DMA_CC4             0x1000      /**< CC4DE: request on each channel 4 compare or capture */
+
+/** @} TIM_Types */
+
+/**
+ * @addtogroup TIM_Functions
+ * @{
+ */
+
+/**
+ * @brief Initializes a timer: up-counting, buffered period, stopped.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Prescaler The timer clock division, 1 to 65536.
+ * @param[in] Copy_Period The number of counts of a period, 1 to 65536.
+ * @retval None
+ */
+void TIM_Init(TIM_Peripheral_t Copy_Timer, u32 Copy_Prescaler, u32 Copy_Period);
+
+/**
+ * @brief Sets the period in microseconds, from the timer clock of the RCC.
+ *
+ * The smallest prescaler is chosen, so the period has the finest resolution. The period is buffered, it is taken at the
+ * next update.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Microseconds The period in microseconds.
+ * @return E_OK, or E_NOT_OK when the period does not fit the 16-bit prescaler and counter.
+ */
+Std_ReturnType TIM_SetPeriodUs(TIM_Peripheral_t Copy_Timer, u32 Copy_Microseconds);
+
+/**
+ * @brief Starts the counter.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @retval None
+ */
+void TIM_Start(TIM_Peripheral_t Copy_Timer);
+
+/**
+ * @brief Stops the counter.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @retval None
+ */
+void TIM_Stop(TIM_Peripheral_t Copy_Timer);
+
+/**
+ * @brief Gets the counter.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @return The counter value.
+ */
+u16 TIM_GetCounter(TIM_Peripheral_t Copy_Timer);
+
+/**
+ * @brief Sets the function called on each update (end of period) and enables the update interrupt.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Callback The function, NULL disables the update interrupt unless an input capture needs it.
+ * @retval None
+ */
+void TIM_SetUpdateCallback(TIM_Peripheral_t Copy_Timer, void (*Copy_Callback)(void));
+
+/**
+ * @brief Sets a channel as a PWM output (PWM mode 1, buffered compare value).
+ *
+ * The duty cycle is Compare / Period, the compare value is set with TIM_SetCompare().
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Channel The channel.
+ * @param[in] Copy_Polarity The output polarity.
+ * @retval None
+ */
+void TIM_SetPwm(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, TIM_PwmPolarity_t Copy_Polarity);
+
+/**
+ * @brief Sets the compare value of a channel.
+ *
+ * For a PWM output it is the number of active counts of the period, taken at the next update.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Channel The channel.
+ * @param[in] Copy_Value The compare value.
+ * @retval None
+ */
+void TIM_SetCompare(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, u16 Copy_Value);
+
+/**
+ * @brief Sets a channel as input capture and enables its interrupt.
+ *
+ * The timestamps passed to the callback are extended to 32 bits with the overflows counted by the update interrupt:
+ * overflows * period + captured counter. The difference of two timestamps is the number of counts between the
+ * edges, even across many periods.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Channel The channel.
+ * @param[in] Copy_Edge The captured edge.
+ * @param[in] Copy_Callback The function called on each capture with the extended timestamp.
+ * @retval None
+ */
+void TIM_SetInputCapture(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, TIM_CaptureEdge_t Copy_Edge, void (*Copy_Callback)(u32 Copy_Timestamp));
+
+/**
+ * @brief Sets a channel as an output compare interrupt, without output pin.
+ *
+ * The callback is called when the counter matches the compare value. The compare value is not buffered, the callback
+ * can move it with TIM_SetCompare() to schedule the next match within the same period.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Channel The channel.
+ * @param[in] Copy_Value The first compare value.
+ * @param[in] Copy_Callback The function called on each match.
+ * @retval None
+ */
+void TIM_SetOutputCompare(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, u16 Copy_Value, void (*Copy_Callback)(void));
+
+/**
+ * @brief Sets a channel to output one pulse per TIM_TriggerPulse().
+ *
+ * The counter runs once (one-pulse mode) and stops by itself. The output goes active after Copy_Delay counts for
+ * Copy_Width counts, the prescaler sets the count length.
+ *
+ * @param[in] Copy_Timer The timer, it should not run PWM on its other channels.
+ * @param[in] Copy_Channel The channel.
+ * @param[in] Copy_Delay The counts from the trigger to the pulse, at least 1.
+ * @param[in] Copy_Width The counts of the pulse, Copy_Delay + Copy_Width at most 65536.
+ * @retval None
+ */
+void TIM_SetOnePulse(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, u16 Copy_Delay, u16 Copy_Width);
+
+/**
+ * @brief Outputs the pulse set by TIM_SetOnePulse(), nothing happens while the previous pulse runs.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @retval None
+ */
+void TIM_TriggerPulse(TIM_Peripheral_t Copy_Timer);
+
+/**
+ * @brief Enables DMA requests of the timer.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Requests TIM_DMA_UPDATE and TIM_DMA_CCx combined.
+ * @retval None
+ */
+void TIM_EnableDmaRequests(TIM_Peripheral_t Copy_Timer, u16 Copy_Requests);
+
+/**
+ * @brief Disables DMA requests of the timer.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Requests TIM_DMA_UPDATE and TIM_DMA_CCx combined.
+ * @retval None
+ */
+void TIM_DisableDmaRequests(TIM_Peripheral_t Copy_Timer, u16 Copy_Requests);
+
+/**
+ * @brief Gets the address of the compare register of a channel, the DMA peripheral address for PWM duty streams.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[in] Copy_Channel The channel.
+ * @return The address of the CCRx register.
+ */
+volatile u32 *TIM_GetCompareRegister(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel);
+
+/** @} TIM_Functions */
+
+#endif /**< __TIM_INTERFACE_H__ */
@@ -0,0 +1,98 @@
+/**
+ ********************************************************************************************
+ * @file TIM_private.h
+ * @brief This file contains the private definitions of the general purpose timers driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TIM_PRIVATE_H__
+#define __TIM_PRIVATE_H__
+
+/**
+ * @brief General purpose timer registers.
+ */
+typedef struct
+{
+    volatile u32 CR1;       /**< Control register 1 */
+    volatile u32 CR2;       /**< Control register 2 */
+    volatile u32 SMCR;      /**< Slave mode control register */
+    volatile u32 DIER;      /**< DMA/interrupt enable register */
+    volatile u32 SR;        /**< Status register */
+    volatile u32 EGR;       /**< Event generation register */
+    volatile u32 CCMR[2];   /**< Capture/compare mode registers, channels 1-2 and 3-4 */
+    volatile u32 CCER;      /**< Capture/compare enable register */
+    volatile u32 CNT;       /**< Counter */
+    volatile u32 PSC;       /**< Prescaler */
+    volatile u32 ARR;       /**< Auto-reload register */
+    volatile u32 RESERVED1;
+    volatile u32 CCR[4];    /**< Capture/compare registers */
+    volatile u32 RESERVED2;
+    volatile u32 DCR;       /**< DMA control register */
+    volatile u32 DMAR;      /**< DMA address for full transfer */
+} TIM_RegDef_t;
+
+#define TIM2_BASE_ADDRESS           0x40000000U
+#define TIM3_BASE_ADDRESS           0x40000400U
+#define TIM4_BASE_ADDRESS           0x40000800U
+
+#define TIM_NUMBER_OF_TIMERS        3
+#define TIM_NUMBER_OF_CHANNELS      4
+
+/**< CR1 */
+#define TIM_CR1_CEN_MASK            0x0001      /**< Counter enable */
+#define TIM_CR1_OPM_MASK            0x0008      /**< One-pulse mode */
+#define TIM_CR1_ARPE_MASK           0x0080      /**< Auto-reload preload enable */
+
+/**< DIER and SR */
+#define TIM_DIER_UIE_MASK           0x0001      /**< Update interrupt enable */
+#define TIM_SR_UIF_MASK             0x0001      /**< Update interrupt flag */
+#define TIM_CC1_FLAG_MASK           0x0002      /**< CC1IE / CC1IF, the next channels follow */
+#define TIM_DIER_CCIE_MASK          0x001E      /**< CC1IE to CC4IE */
+#define TIM_SR_IRQ_MASK             0x001F      /**< UIF and CC1IF to CC4IF */
+#define TIM_DIER_DMA_MASK           0x1F00      /**< UDE and CC1DE to CC4DE */
+
+/**< EGR */
+#define TIM_EGR_UG_MASK             0x0001      /**< Update generation */
+
+/**< CCMRx, one byte per channel */
+#define TIM_CCMR_OCM_FROZEN         0x00        /**< OCxM: output compare without effect on the output */
+#define TIM_CCMR_CCS_INPUT_TI       0x01        /**< CCxS: input mapped on its own TIx */
+#define TIM_CCMR_OCPE_MASK          0x08        /**< OCxPE: compare preload enable */
+#define TIM_CCMR_OCM_PWM1           0x60        /**< OCxM: PWM mode 1, active while CNT < CCRx */
+#define TIM_CCMR_OCM_PWM2           0x70        /**< OCxM: PWM mode 2, active while CNT >= CCRx */
+#define TIM_CCMR_ICF_POS            4           /**< ICxF: input filter */
+#define TIM_CCMR_CHANNEL_MASK       0xFF
+
+/**< CCER, one nibble per channel */
+#define TIM_CCER_CCE_MASK           0x1         /**< CCxE: output or capture enable */
+#define TIM_CCER_CCP_MASK           0x2         /**< CCxP: active low output or falling edge capture */
+
+/**
+ * @brief Gets the registers of a timer.
+ *
+ * @param Copy_Timer The timer.
+ * @return Pointer to its registers.
+ */
+static TIM_RegDef_t *TIM_GetRegisters(TIM_Peripheral_t Copy_Timer);
+
+/**
+ * @brief Writes the mode byte of a channel in its CCMR register.
+ *
+ * @param Copy_Registers The timer registers.
+ * @param Copy_Channel The channel.
+ * @param Copy_Mode The channel mode byte.
+ */
+static void TIM_SetChannelMode(TIM_RegDef_t *Copy_Registers, TIM_Channel_t Copy_Channel, u8 Copy_Mode);
+
+/**
+ * @brief Handles the interrupt of a timer: overflows, update callback and captures.
+ *
+ * @param Copy_Timer The timer.
+ */
+static void TIM_HandleIRQ(TIM_Peripheral_t Copy_Timer);
+
+#endif /**< __TIM_PRIVATE_H__ */
@@ -0,0 +1,373 @@
+/**
+ ********************************************************************************************
+ * @file TIM_program.c
+ * @brief This file contains the implementation of the general purpose timers driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "RCC_interface.h"
+#include "TIM_interface.h"
+#include "TIM_config.h"
+#include "TIM_private.h"
+
+#if (TIM_CAPTURE_FILTER < 0) || (TIM_CAPTURE_FILTER > 15)
+    #error "The input capture filter is 0 to 15"
+#endif
+
+/**< Callbacks of the update and of the input captures */
+static void (*TIM_UpdateCallback[TIM_NUMBER_OF_TIMERS])(void) = {NULL};
+static void (*TIM_CaptureCallback[TIM_NUMBER_OF_TIMERS][TIM_NUMBER_OF_CHANNELS])(u32 Copy_Timestamp) = {{NULL}};
+static void (*TIM_CompareCallback[TIM_NUMBER_OF_TIMERS][TIM_NUMBER_OF_CHANNELS])(void) = {{NULL}};
+
+/**< Overflows counted by the update interrupt, the upper part of the capture timestamps */
+static volatile u32 TIM_Overflows[TIM_NUMBER_OF_TIMERS] = {0};
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void TIM_Init(TIM_Peripheral_t Copy_Timer, u32 Copy_Prescaler, u32 Copy_Period)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if ((Local_Timer == NULL) || (Copy_Prescaler == 0) || (Copy_Prescaler > 0x10000) || (Copy_Period == 0) || (Copy_Period > 0x10000))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    /**< Stopped, up-counting, buffered period */
+    Local_Timer->CR1 = TIM_CR1_ARPE_MASK;
+    Local_Timer->DIER = 0;
+    Local_Timer->CCER = 0;
+    Local_Timer->CCMR[0] = 0;
+    Local_Timer->CCMR[1] = 0;
+    Local_Timer->PSC = Copy_Prescaler - 1;
+    Local_Timer->ARR = Copy_Period - 1;
+
+    /**< Load the prescaler and the period now, the update flag it sets is not an overflow */
+    Local_Timer->EGR = TIM_EGR_UG_MASK;
+    Local_Timer->SR = 0;
+
+    TIM_Overflows[Copy_Timer] = 0;
+}
+
+Std_ReturnType TIM_SetPeriodUs(TIM_Peripheral_t Copy_Timer, u32 Copy_Microseconds)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+    u32 Local_ClockPerMs = RCC_GetAPB1TimerClockFreq() / 1000;
+    u64 Local_Counts;
+    u32 Local_Prescaler;
+    u32 Local_Period;
+
+    if (Local_Timer == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Whole milliseconds and the rest apart, integer math only */
+    Local_Counts = ((u64)(Copy_Microseconds / 1000) * Local_ClockPerMs) + (((Copy_Microseconds % 1000) * Local_ClockPerMs) / 1000);
+
+    if ((Local_Counts == 0) || (Local_Counts > 0xFFFFFFFFUL))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Smallest prescaler that fits the period in 16 bits */
+    Local_Period = (u32)Local_Counts;
+    Local_Prescaler = (Local_Period >> 16) + ((Local_Period & 0xFFFF) != 0);
+    Local_Timer->PSC = Local_Prescaler - 1;
+    Local_Timer->ARR = (Local_Period / Local_Prescaler) - 1;
+
+    return E_OK;
+}
+
+void TIM_Start(TIM_Peripheral_t Copy_Timer)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if (Local_Timer != NULL)
+    {
+        Local_Timer->CR1 |= TIM_CR1_CEN_MASK;
+    }
+}
+
+void TIM_Stop(TIM_Peripheral_t Copy_Timer)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if (Local_Timer != NULL)
+    {
+        Local_Timer->CR1 &= ~TIM_CR1_CEN_MASK;
+    }
+}
+
+u16 TIM_GetCounter(TIM_Peripheral_t Copy_Timer)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    return (Local_Timer != NULL) ? (u16)Local_Timer->CNT : 0;
+}
+
+void TIM_SetUpdateCallback(TIM_Peripheral_t Copy_Timer, void (*Copy_Callback)(void))
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if (Local_Timer == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    TIM_UpdateCallback[Copy_Timer] = Copy_Callback;
+
+    if (Copy_Callback != NULL)
+    {
+        Local_Timer->SR = ~TIM_SR_UIF_MASK;
+        Local_Timer->DIER |= TIM_DIER_UIE_MASK;
+    }
+    else if (!(Local_Timer->DIER & TIM_DIER_CCIE_MASK))
+    {
+        /**< The captures count the overflows with it, keep it while a channel interrupt is on */
+        Local_Timer->DIER &= ~TIM_DIER_UIE_MASK;
+    }
+}
+
+void TIM_SetPwm(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, TIM_PwmPolarity_t Copy_Polarity)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if ((Local_Timer == NULL) || (Copy_Channel > TIM_CHANNEL4))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    TIM_SetChannelMode(Local_Timer, Copy_Channel, TIM_CCMR_OCM_PWM1 | TIM_CCMR_OCPE_MASK);
+
+    if (Copy_Polarity == TIM_PWM_ACTIVE_LOW)
+    {
+        Local_Timer->CCER |= TIM_CCER_CCP_MASK << (Copy_Channel * 4);
+    }
+    else
+    {
+        Local_Timer->CCER &= ~(TIM_CCER_CCP_MASK << (Copy_Channel * 4));
+    }
+    Local_Timer->CCER |= TIM_CCER_CCE_MASK << (Copy_Channel * 4);
+}
+
+void TIM_SetCompare(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, u16 Copy_Value)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if ((Local_Timer != NULL) && (Copy_Channel <= TIM_CHANNEL4))
+    {
+        Local_Timer->CCR[Copy_Channel] = Copy_Value;
+    }
+}
+
+void TIM_SetInputCapture(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, TIM_CaptureEdge_t Copy_Edge, void (*Copy_Callback)(u32 Copy_Timestamp))
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if ((Local_Timer == NULL) || (Copy_Channel > TIM_CHANNEL4) || (Copy_Callback == NULL))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    TIM_CaptureCallback[Copy_Timer][Copy_Channel] = Copy_Callback;
+    TIM_CompareCallback[Copy_Timer][Copy_Channel] = NULL;
+
+    /**< CCxS can only be written while the channel is disabled */
+    Local_Timer->CCER &= ~((TIM_CCER_CCE_MASK | TIM_CCER_CCP_MASK) << (Copy_Channel * 4));
+    TIM_SetChannelMode(Local_Timer, Copy_Channel, TIM_CCMR_CCS_INPUT_TI | (TIM_CAPTURE_FILTER << TIM_CCMR_ICF_POS));
+
+    if (Copy_Edge == TIM_CAPTURE_FALLING)
+    {
+        Local_Timer->CCER |= TIM_CCER_CCP_MASK << (Copy_Channel * 4);
+    }
+    Local_Timer->CCER |= TIM_CCER_CCE_MASK << (Copy_Channel * 4);
+
+    /**< The capture and the update interrupts, the update counts the overflows */
+    Local_Timer->SR = ~((u32)TIM_CC1_FLAG_MASK << Copy_Channel);
+    Local_Timer->DIER |= ((u32)TIM_CC1_FLAG_MASK << Copy_Channel) | TIM_DIER_UIE_MASK;
+}
+
+void TIM_SetOutputCompare(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, u16 Copy_Value, void (*Copy_Callback)(void))
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if ((Local_Timer == NULL) || (Copy_Channel > TIM_CHANNEL4) || (Copy_Callback == NULL))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    TIM_CompareCallback[Copy_Timer][Copy_Channel] = Copy_Callback;
+    TIM_CaptureCallback[Copy_Timer][Copy_Channel] = NULL;
+
+    /**< Frozen output and no preload: a new compare value is used at once */
+    Local_Timer->CCER &= ~((TIM_CCER_CCE_MASK | TIM_CCER_CCP_MASK) << (Copy_Channel * 4));
+    TIM_SetChannelMode(Local_Timer, Copy_Channel, TIM_CCMR_OCM_FROZEN);
+    Local_Timer->CCR[Copy_Channel] = Copy_Value;
+
+    Local_Timer->SR = ~((u32)TIM_CC1_FLAG_MASK << Copy_Channel);
+    Local_Timer->DIER |= (u32)TIM_CC1_FLAG_MASK << Copy_Channel;
+}
+
+void TIM_SetOnePulse(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel, u16 Copy_Delay, u16 Copy_Width)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if ((Local_Timer == NULL) || (Copy_Channel > TIM_CHANNEL4) || (Copy_Delay == 0) || (Copy_Width == 0) || (((u32)Copy_Delay + Copy_Width) > 0x10000))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    /**< PWM mode 2: inactive until CCRx, active from CCRx to the end of the single period */
+    Local_Timer->CR1 &= ~TIM_CR1_CEN_MASK;
+    Local_Timer->CR1 |= TIM_CR1_OPM_MASK;
+    TIM_SetChannelMode(Local_Timer, Copy_Channel, TIM_CCMR_OCM_PWM2 | TIM_CCMR_OCPE_MASK);
+    Local_Timer->CCR[Copy_Channel] = Copy_Delay;
+    Local_Timer->ARR = (u32)Copy_Delay + Copy_Width - 1;
+    Local_Timer->CNT = 0;
+
+    /**< Load the buffered values without starting a pulse */
+    Local_Timer->EGR = TIM_EGR_UG_MASK;
+    Local_Timer->SR = ~TIM_SR_UIF_MASK;
+
+    Local_Timer->CCER &= ~(TIM_CCER_CCP_MASK << (Copy_Channel * 4));
+    Local_Timer->CCER |= TIM_CCER_CCE_MASK << (Copy_Channel * 4);
+}
+
+void TIM_TriggerPulse(TIM_Peripheral_t Copy_Timer)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    /**< The hardware clears CEN at the end of the pulse */
+    if ((Local_Timer != NULL) && !(Local_Timer->CR1 & TIM_CR1_CEN_MASK))
+    {
+        Local_Timer->CR1 |= TIM_CR1_CEN_MASK;
+    }
+}
+
+void TIM_EnableDmaRequests(TIM_Peripheral_t Copy_Timer, u16 Copy_Requests)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if (Local_Timer != NULL)
+    {
+        Local_Timer->DIER |= Copy_Requests & TIM_DIER_DMA_MASK;
+    }
+}
+
+void TIM_DisableDmaRequests(TIM_Peripheral_t Copy_Timer, u16 Copy_Requests)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if (Local_Timer != NULL)
+    {
+        Local_Timer->DIER &= ~(Copy_Requests & TIM_DIER_DMA_MASK);
+    }
+}
+
+volatile u32 *TIM_GetCompareRegister(TIM_Peripheral_t Copy_Timer, TIM_Channel_t Copy_Channel)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+
+    if ((Local_Timer == NULL) || (Copy_Channel > TIM_CHANNEL4))
+    {
+        return NULL;
+    }
+
+    return &Local_Timer->CCR[Copy_Channel];
+}
+
+void TIM2_IRQHandler(void)
+{
+    TIM_HandleIRQ(TIM2);
+}
+
+void TIM3_IRQHandler(void)
+{
+    TIM_HandleIRQ(TIM3);
+}
+
+void TIM4_IRQHandler(void)
+{
+    TIM_HandleIRQ(TIM4);
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static TIM_RegDef_t *TIM_GetRegisters(TIM_Peripheral_t Copy_Timer)
+{
+    TIM_RegDef_t *Local_Registers = NULL;
+
+    switch (Copy_Timer)
+    {
+        case TIM2: Local_Registers = (TIM_RegDef_t *)TIM2_BASE_ADDRESS; break;
+        case TIM3: Local_Registers = (TIM_RegDef_t *)TIM3_BASE_ADDRESS; break;
+        case TIM4: Local_Registers = (TIM_RegDef_t *)TIM4_BASE_ADDRESS; break;
+        default: /**< Not a general purpose timer */ break;
+    }
+
+    return Local_Registers;
+}
+
+static void TIM_SetChannelMode(TIM_RegDef_t *Copy_Registers, TIM_Channel_t Copy_Channel, u8 Copy_Mode)
+{
+    u8 Local_Shift = (Copy_Channel & 1) * 8;
+
+    Copy_Registers->CCMR[Copy_Channel >> 1] = (Copy_Registers->CCMR[Copy_Channel >> 1] & ~((u32)TIM_CCMR_CHANNEL_MASK << Local_Shift)) | ((u32)Copy_Mode << Local_Shift);
+}
+
+static void TIM_HandleIRQ(TIM_Peripheral_t Copy_Timer)
+{
+    TIM_RegDef_t *Local_Timer = TIM_GetRegisters(Copy_Timer);
+    u32 Local_Status = Local_Timer->SR & Local_Timer->DIER & TIM_SR_IRQ_MASK;
+    u32 Local_Period = Local_Timer->ARR + 1;
+    u32 Local_Overflows = TIM_Overflows[Copy_Timer];
+    u32 Local_Captured;
+
+    /**< Clear the flags that are handled, the others are written as 1 and stay */
+    Local_Timer->SR = ~Local_Status;
+
+    for (u8 Local_Channel = 0; Local_Channel < TIM_NUMBER_OF_CHANNELS; Local_Channel++)
+    {
+        if ((Local_Status & ((u32)TIM_CC1_FLAG_MASK << Local_Channel)) && (TIM_CaptureCallback[Copy_Timer][Local_Channel] != NULL))
+        {
+            Local_Captured = Local_Timer->CCR[Local_Channel];
+
+            /**< An overflow pending with the capture happened before it when the capture is in the first half of the period */
+            if ((Local_Status & TIM_SR_UIF_MASK) && (Local_Captured < (Local_Period / 2)))
+            {
+                TIM_CaptureCallback[Copy_Timer][Local_Channel](((Local_Overflows + 1) * Local_Period) + Local_Captured);
+            }
+            else
+            {
+                TIM_CaptureCallback[Copy_Timer][Local_Channel]((Local_Overflows * Local_Period) + Local_Captured);
+            }
+        }
+        else if ((Local_Status & ((u32)TIM_CC1_FLAG_MASK << Local_Channel)) && (TIM_CompareCallback[Copy_Timer][Local_Channel] != NULL))
+        {
+            TIM_CompareCallback[Copy_Timer][Local_Channel]();
+        }
+    }
+
+    if (Local_Status & TIM_SR_UIF_MASK)
+    {
+        TIM_Overflows[Copy_Timer] = Local_Overflows + 1;
+
+        if (TIM_UpdateCallback[Copy_Timer] != NULL)
+        {
+            TIM_UpdateCallback[Copy_Timer]();
+        }
+    }
+}
@@ -0,0 +1,29 @@
+/**
+ ********************************************************************************************
+ * @file RTC_config.h
+ * @brief This file contains the configuration of the real-time clock driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __RTC_CONFIG_H__
+#define __RTC_CONFIG_H__
+
+/**
+ * @brief The RTC clock.
+ *
+ * Available options:
+ * - RTC_CLOCK_LSE: 32.768 kHz crystal, accurate and kept on VBAT.
+ * - RTC_CLOCK_LSI: internal RC, no crystal needed, 30 to 60 kHz (the seconds are only approximate).
+ */
+#define RTC_CLOCK_SOURCE            RTC_CLOCK_LSE
+
+/**
+ * @brief The LSI frequency used for the prescaler, measured or typical.
+ */
+#define RTC_LSI_FREQUENCY           40000
+
+#endif /**< __RTC_CONFIG_H__ */
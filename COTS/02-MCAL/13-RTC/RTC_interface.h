@@ -0,0 +1,87 @@
+/**
+ ********************************************************************************************
+ * @file RTC_interface.h
+ * @brief This file contains the interface of the real-time clock driver.
+ *
+ * The STM32F10x RTC is a 32-bit seconds counter in the backup domain, clocked through a prescaler from the LSE or the
+ * LSI. It keeps counting across resets (and on VBAT with the LSE), independently of the SysTick. The prescaler divider
+ * gives the fraction of the current second.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __RTC_INTERFACE_H__
+#define __RTC_INTERFACE_H__
+
+/**
+ * @addtogroup RTC_Types
+ * @{
+ */
+
+/**
+ * @brief Converts a sub-second fraction (1/65536 s) to milliseconds.
+ */
+#define RTC_SUBSECONDS_TO_MS(SUB)   ((u16)(((u32)(SUB) * 1000) >> 16))
+
+/** @} RTC_Types */
+
+/**
+ * @addtogroup RTC_Functions
+ * @{
+ */
+
+/**
+ * @brief Starts the RTC clock and configures the RTC when it was not running.
+ *
+ * A running RTC (after a reset) keeps its counter, only the registers are synchronized again.
+ *
+ * @return E_OK, or E_NOT_OK when the oscillator did not start.
+ */
+Std_ReturnType RTC_Init(void);
+
+/**
+ * @brief Gets the seconds counter.
+ *
+ * @return The counter, by convention the seconds since 1970-01-01 00:00:00 UTC.
+ */
+u32 RTC_GetCounter(void);
+
+/**
+ * @brief Sets the seconds counter, the current second starts again.
+ *
+ * @param[in] Copy_Seconds The new counter value.
+ * @retval None
+ */
+void RTC_SetCounter(u32 Copy_Seconds);
+
+/**
+ * @brief Gets the seconds counter and the fraction of the current second, read together.
+ *
+ * @param[out] Copy_Seconds Returns the counter.
+ * @param[out] Copy_Subseconds Returns the fraction of the second in 1/65536 s.
+ * @retval None
+ */
+void RTC_GetTimestamp(u32 *Copy_Seconds, u16 *Copy_Subseconds);
+
+/**
+ * @brief Sets the alarm and enables its interrupt (RTC global interrupt, NVIC line enabled by the application).
+ *
+ * @param[in] Copy_Seconds The counter value of the alarm.
+ * @param[in] Copy_Callback The function called from the interrupt when the counter reaches it.
+ * @retval None
+ */
+void RTC_SetAlarm(u32 Copy_Seconds, void (*Copy_Callback)(void));
+
+/**
+ * @brief Disables the alarm interrupt.
+ *
+ * @retval None
+ */
+void RTC_DisableAlarm(void);
+
+/** @} RTC_Functions */
+
+#endif /**< __RTC_INTERFACE_H__ */
@@ -0,0 +1,67 @@
+/**
+ ********************************************************************************************
+ * @file RTC_private.h
+ * @brief This file contains the private definitions of the real-time clock driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __RTC_PRIVATE_H__
+#define __RTC_PRIVATE_H__
+
+/**
+ * @brief Options of RTC_CLOCK_SOURCE.
+ */
+#define RTC_CLOCK_LSE               0
+#define RTC_CLOCK_LSI               1
+
+#if RTC_CLOCK_SOURCE == RTC_CLOCK_LSE
+    #define RTC_RCC_SOURCE          RCC_RTC_CLOCK_LSE
+    #define RTC_PRESCALER           32768UL
+#elif RTC_CLOCK_SOURCE == RTC_CLOCK_LSI
+    #define RTC_RCC_SOURCE          RCC_RTC_CLOCK_LSI
+    #define RTC_PRESCALER           ((u32)RTC_LSI_FREQUENCY)
+#else
+    #error "Wrong choice of RTC clock source"
+#endif
+
+/**
+ * @brief RTC registers, 16 bits used in each.
+ */
+typedef struct
+{
+    volatile u32 CRH;       /**< Control register high: interrupt enables */
+    volatile u32 CRL;       /**< Control register low: flags and configuration mode */
+    volatile u32 PRLH;      /**< Prescaler load, high part */
+    volatile u32 PRLL;      /**< Prescaler load, low part */
+    volatile u32 DIVH;      /**< Prescaler divider, high part */
+    volatile u32 DIVL;      /**< Prescaler divider, low part */
+    volatile u32 CNTH;      /**< Counter, high part */
+    volatile u32 CNTL;      /**< Counter, low part */
+    volatile u32 ALRH;      /**< Alarm, high part */
+    volatile u32 ALRL;      /**< Alarm, low part */
+} RTC_RegDef_t;
+
+#define RTC_BASE_ADDRESS            0x40002800U
+#define RTC                         ((RTC_RegDef_t *)RTC_BASE_ADDRESS)
+
+#define RTC_CRH_ALRIE_MASK          0x0002      /**< Alarm interrupt enable */
+#define RTC_CRL_ALRF_MASK           0x0002      /**< Alarm flag */
+#define RTC_CRL_RSF_MASK            0x0008      /**< Registers synchronized flag */
+#define RTC_CRL_CNF_MASK            0x0010      /**< Configuration mode */
+#define RTC_CRL_RTOFF_MASK          0x0020      /**< Last write operation finished */
+
+/**
+ * @brief Enters the configuration mode, after the last write finished.
+ */
+static void RTC_EnterConfiguration(void);
+
+/**
+ * @brief Leaves the configuration mode and waits until the RTC took the writes.
+ */
+static void RTC_ExitConfiguration(void);
+
+#endif /**< __RTC_PRIVATE_H__ */
@@ -0,0 +1,149 @@
+/**
+ ********************************************************************************************
+ * @file RTC_program.c
+ * @brief This file contains the implementation of the real-time clock driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "RCC_interface.h"
+#include "RTC_interface.h"
+#include "RTC_config.h"
+#include "RTC_private.h"
+
+static void (*RTC_AlarmCallback)(void) = NULL;
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+Std_ReturnType RTC_Init(void)
+{
+    u8 Local_Status;
+
+    RCC_EnableBackupDomainAccess();
+    Local_Status = RCC_StartRtcClock(RTC_RCC_SOURCE);
+
+    if (Local_Status == RCC_RTC_CLOCK_FAILED)
+    {
+        return E_NOT_OK;
+    }
+
+    /**< The APB1 copies of the RTC registers are valid once resynchronized */
+    RTC->CRL &= ~RTC_CRL_RSF_MASK;
+    while (!(RTC->CRL & RTC_CRL_RSF_MASK));
+
+    if (Local_Status == RCC_RTC_CLOCK_STARTED)
+    {
+        /**< One count per second */
+        RTC_EnterConfiguration();
+        RTC->PRLH = (RTC_PRESCALER - 1) >> 16;
+        RTC->PRLL = (RTC_PRESCALER - 1) & 0xFFFF;
+        RTC->CNTH = 0;
+        RTC->CNTL = 0;
+        RTC_ExitConfiguration();
+    }
+
+    return E_OK;
+}
+
+u32 RTC_GetCounter(void)
+{
+    u32 Local_High;
+    u32 Local_Low;
+
+    /**< The low part may carry into the high part between the two reads */
+    do
+    {
+        Local_High = RTC->CNTH;
+        Local_Low = RTC->CNTL;
+    } while (Local_High != RTC->CNTH);
+
+    return (Local_High << 16) | (Local_Low & 0xFFFF);
+}
+
+void RTC_SetCounter(u32 Copy_Seconds)
+{
+    RTC_EnterConfiguration();
+    RTC->CNTH = Copy_Seconds >> 16;
+    RTC->CNTL = Copy_Seconds & 0xFFFF;
+    RTC_ExitConfiguration();
+}
+
+void RTC_GetTimestamp(u32 *Copy_Seconds, u16 *Copy_Subseconds)
+{
+    u32 Local_Seconds;
+    u32 Local_Divider;
+
+    if ((Copy_Seconds == NULL) || (Copy_Subseconds == NULL))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    /**< The divider reloads when the counter increments, read again when the second changed */
+    do
+    {
+        Local_Seconds = RTC_GetCounter();
+        Local_Divider = ((RTC->DIVH & 0xF) << 16) | (RTC->DIVL & 0xFFFF);
+    } while (Local_Seconds != RTC_GetCounter());
+
+    /**< The divider counts down from the prescaler load, a division by a constant */
+    *Copy_Seconds = Local_Seconds;
+    *Copy_Subseconds = (u16)((((u64)(RTC_PRESCALER - 1 - Local_Divider)) << 16) / RTC_PRESCALER);
+}
+
+void RTC_SetAlarm(u32 Copy_Seconds, void (*Copy_Callback)(void))
+{
+    if (Copy_Callback == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    RTC_AlarmCallback = Copy_Callback;
+
+    RTC_EnterConfiguration();
+    RTC->ALRH = Copy_Seconds >> 16;
+    RTC->ALRL = Copy_Seconds & 0xFFFF;
+    RTC_ExitConfiguration();
+
+    RTC->CRL &= ~RTC_CRL_ALRF_MASK;
+    RTC->CRH |= RTC_CRH_ALRIE_MASK;
+}
+
+void RTC_DisableAlarm(void)
+{
+    RTC->CRH &= ~RTC_CRH_ALRIE_MASK;
+}
+
+void RTC_IRQHandler(void)
+{
+    if (RTC->CRL & RTC_CRL_ALRF_MASK)
+    {
+        /**< The flags are cleared by writing 0, the other bits are written unchanged */
+        RTC->CRL &= ~RTC_CRL_ALRF_MASK;
+
+        if (RTC_AlarmCallback != NULL)
+        {
+            RTC_AlarmCallback();
+        }
+    }
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void RTC_EnterConfiguration(void)
+{
+    while (!(RTC->CRL & RTC_CRL_RTOFF_MASK));
+    RTC->CRL |= RTC_CRL_CNF_MASK;
+}
+
+static void RTC_ExitConfiguration(void)
+{
+    RTC->CRL &= ~RTC_CRL_CNF_MASK;
+    while (!(RTC->CRL & RTC_CRL_RTOFF_MASK));
+}
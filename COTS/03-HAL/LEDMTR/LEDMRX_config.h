@@ -32,6 +32,88 @@
  */
 #define LEDMTRX_NUM_COLS 8
 
+/**
+ * @brief How the matrix is driven.
+ * 
+ * @note The available options are:
+ *       - LEDMTRX_DRIVER_GPIO: One matrix multiplexed directly from the row and column pins below.
+ *       - LEDMTRX_DRIVER_MAX7219: LEDMTRX_NUM_PANELS matrices behind a chain of MAX7219 on SPI, digit n driving
+ *         column n and segment bit n driving row n. Each column step is one SPI burst for all the panels.
+ */
+#define LEDMTRX_DRIVER LEDMTRX_DRIVER_GPIO
+
+/**
+ * @brief The number of chained matrices, placed left to right to form a canvas of LEDMTRX_NUM_PANELS x LEDMTRX_NUM_COLS columns.
+ * 
+ * Panel 0 (the leftmost) is the one wired to the microcontroller. Must be 1 with LEDMTRX_DRIVER_GPIO.
+ */
+#define LEDMTRX_NUM_PANELS 1
+
+/**
+ * @brief The SPI peripheral of the MAX7219 chain (SPI1, SPI2 or SPI3).
+ * 
+ * @note The application initializes the peripheral (8-bit frames, MSB first, CPOL = 0, CPHA = 0) and its pins.
+ */
+#define LEDMTRX_SPI_PERIPHERAL SPI1
+
+/**
+ * @brief The pin driving the LOAD (chip select) input of the MAX7219 chain.
+ */
+#define LEDMTRX_CS_PIN                   GPIO_PORTA, 4
+
+/**
+ * @brief The refresh rate of the whole matrix in frames per second.
+ *
+ * One column is scanned per tick, so the tick period is 1 / (LEDMTRX_REFRESH_RATE_HZ * LEDMTRX_NUM_COLS).
+ * 
+ * @note Below about 60 Hz the matrix visibly flickers.
+ */
+#define LEDMTRX_REFRESH_RATE_HZ 100
+
+/**
+ * @brief The tick source driving the background refresh.
+ * 
+ * @note The available options are:
+ *       - LEDMTRX_REFRESH_SOURCE_STK: The module programs the SysTick periodic interval itself.
+ *       - LEDMTRX_REFRESH_SOURCE_EXTERNAL: The application calls LEDMTRX_RefreshTick() every LEDMTRX_COLUMN_PERIOD_US,
+ *         e.g. from an OS task when the SysTick is owned by the OS.
+ */
+#define LEDMTRX_REFRESH_SOURCE LEDMTRX_REFRESH_SOURCE_STK
+
+/**
+ * @brief Enables the measurement of the column switch latency in LEDMTRX_RefreshTick().
+ * 
+ * @note The available options are:
+ *       - LEDMTRX_JITTER_STATS_ENABLE
+ *       - LEDMTRX_JITTER_STATS_DISABLE
+ */
+#define LEDMTRX_JITTER_STATS LEDMTRX_JITTER_STATS_ENABLE
+
+/**
+ * @brief Enables the 4-bit grayscale (16 levels per LED) using binary code modulation.
+ *
+ * Each column time is split into sub-slots of 1, 2, 4 and 8 units lit from the bit planes of the frame, followed by
+ * a blank sub-slot, so a column costs 5 ticks whatever the number of levels. The sub-slots have different lengths,
+ * so this option needs LEDMTRX_REFRESH_SOURCE_STK.
+ * 
+ * @note The available options are:
+ *       - LEDMTRX_GRAYSCALE_ENABLE
+ *       - LEDMTRX_GRAYSCALE_DISABLE
+ */
+#define LEDMTRX_GRAYSCALE LEDMTRX_GRAYSCALE_DISABLE
+
+/**
+ * @brief The shortest sub-slot in microseconds.
+ *
+ * It must cover the tick interrupt time. The dimmest brightness levels are clamped to it.
+ */
+#define LEDMTRX_BCM_MIN_SLOT_US 10
+
+/**
+ * @brief The global brightness applied by LEDMTRX_Init(), 0 (off) to 255 (full).
+ */
+#define LEDMTRX_DEFAULT_BRIGHTNESS 255
+
 
 
 /**
@@ -10,24 +10,58 @@
  */
 #ifndef __LEDMATRIX_INTERFACE_H__
 #define __LEDMATRIX_INTERFACE_H__
+
+/**
+ * @brief Statistics of the background refresh.
+ *
+ * The latencies are measured in SysTick counts between the tick firing and the column switch,
+ * so they are only meaningful when the refresh is driven from SysTick (directly or through the OS tick).
+ */
+typedef struct
+{
+    u32 Frames;         /**< Number of complete frames scanned */
+    u32 LastLatency;    /**< Latency of the last column switch */
+    u32 MinLatency;     /**< Smallest latency seen */
+    u32 MaxLatency;     /**< Largest latency seen, MaxLatency - MinLatency is the refresh jitter */
+} LEDMTRX_RefreshStats_t;
+
+/**
+ * @brief Number of columns of the whole canvas, all the chained panels side by side.
+ */
+#define LEDMTRX_CANVAS_COLS                     (LEDMTRX_NUM_COLS * LEDMTRX_NUM_PANELS)
+
+/**
+ * @brief Number of stream columns per character rendered by LEDMTRX_ScrollText() (5 glyph columns and a gap).
+ */
+#define LEDMTRX_SCROLL_CHAR_COLS                6
+
+/**
+ * @brief Size in bytes of the buffer LEDMTRX_ScrollText() needs for a text of LENGTH characters.
+ *
+ * A blank canvas width is appended so the end of the text scrolls out before the start comes back.
+ */
+#define LEDMTRX_SCROLL_BUFFER_SIZE(LENGTH)      (((u32)(LENGTH) * LEDMTRX_SCROLL_CHAR_COLS) + LEDMTRX_CANVAS_COLS)
+
 /**
  * @brief Turn on an LED at a specific row and column in the LED matrix.
  * 
- * This function turns on the LED at the specified row and column in the LED matrix.
+ * This function sets the LED bit (full intensity) in the draw frame, a single bit operation.
+ * The change is shown after the next LEDMTRX_Update().
  * 
- * @param Copy_u8Row The row number of the LED to turn on (0-indexed).
- * @param Copy_u8Col The column number of the LED to turn on (0-indexed).
+ * @param Copy_Row The row number of the LED to turn on (0-indexed).
+ * @param Copy_Col The canvas column number of the LED to turn on (0-indexed).
  * @return None.
  */
-void HLEDMTRX_voidTurnOn(u8 Copy_u8Row, u8 Copy_u8Col);
+void LEDMTRX_TurnOn(u8 Copy_Row, u8 Copy_Col);
 
 /**
  * @brief Turn off an LED at a specific row and column in the LED matrix.
  * 
- * This function turns off the LED at the specified row and column in the LED matrix.
+ * This function clears the LED bit in the draw frame, a single bit operation.
+ * The change is shown after the next LEDMTRX_Update().
  * 
- * @param Copy_u8Row The row number of the LED to turn off (0-indexed).
- * @param Copy_u8Col The column number of the LED to turn off (0-indexed).
+ * @param Copy_Row The row number of the LED to turn off (0-indexed).
+ * @param Copy_Col The canvas column number of the LED to turn off (0-indexed).
  * @return None.
  */
 void LEDMTRX_TurnOff(u8 Copy_Row, u8 Copy_Col);
@@ -35,12 +69,22 @@ void LEDMTRX_TurnOff(u8 Copy_Row, u8 Copy_Col);
 /**
  * @brief Clear all LEDs in the LED matrix.
  * 
- * This function turns off all LEDs in the LED matrix.
+ * This function turns off all LEDs in the draw frame. The change is shown after the next LEDMTRX_Update().
  * 
  * @return None.
  */
 void LEDMTRX_Clear(void);
 
+/**
+ * @brief Shows the draw frame.
+ *
+ * The draw frame is copied to the back frame and the refresh swaps it in at the next frame boundary, so all
+ * the changes made since the last update appear together. The draw frame keeps its content for the next changes.
+ * 
+ * @return None.
+ */
+void LEDMTRX_Update(void);
+
 /**
  * @brief Initialize the LED matrix.
  * 
@@ -51,30 +95,131 @@ void LEDMTRX_Clear(void);
 void LEDMTRX_Init(void);
 
 /**
- * @brief Displays data on the LED Matrix.
+ * @brief Hands a new frame to the background refresh.
+ *
+ * The frame replaces the draw frame and is shown as by LEDMTRX_Update(): the buffers are swapped by the refresh
+ * at the next frame boundary, so a frame is never shown half updated. The function does not wait for the swap.
+ *
+ * @param Copy_Data Pointer to an array of LEDMTRX_CANVAS_COLS bytes, one per canvas column, bit n drives row n.
+ *
+ * @return None.
+ */
+void LEDMTRX_Display(const u8 *Copy_Data);
+
+/**
+ * @brief Hands a new grayscale frame to the background refresh.
+ *
+ * Same as LEDMTRX_Display() with one 4-bit level (0 to 15) per LED. Without LEDMTRX_GRAYSCALE_ENABLE
+ * the LEDs with a level of 8 or more are on.
+ *
+ * @param Copy_Levels Pointer to LEDMTRX_NUM_ROWS x LEDMTRX_CANVAS_COLS levels, row by row.
+ *
+ * @return None.
+ */
+void LEDMTRX_DisplayGray(const u8 *Copy_Levels);
+
+/**
+ * @brief Sets the global brightness.
+ *
+ * With LEDMTRX_GRAYSCALE_ENABLE the lit sub-slots are scaled and the blank one takes the rest of the column time,
+ * so the 16 levels and the refresh rate are kept. Without grayscale 0 turns the matrix off and any other value is full.
+ *
+ * @param Copy_Brightness The brightness, 0 (off) to 255 (full).
+ *
+ * @return None.
+ */
+void LEDMTRX_SetBrightness(u8 Copy_Brightness);
+
+/**
+ * @brief Starts the background refresh.
+ *
+ * With LEDMTRX_REFRESH_SOURCE_STK the SysTick is programmed to call LEDMTRX_RefreshTick() every
+ * LEDMTRX_COLUMN_PERIOD_US. With LEDMTRX_REFRESH_SOURCE_EXTERNAL the application calls it from its own
+ * timer interrupt or OS task at that period.
  *
- * This function displays data on the LED Matrix by enabling one column at a time and setting
- * the values for the rows. It uses an array of 8 bytes to represent the data for each column.
- * The function shifts the data to the left after displaying all columns, creating a scrolling
- * effect.
+ * @return None.
+ */
+void LEDMTRX_StartRefresh(void);
+
+/**
+ * @brief Stops the background refresh and turns all the columns off.
+ *
+ * @return None.
+ */
+void LEDMTRX_StopRefresh(void);
+
+/**
+ * @brief Scans the next column of the front frame.
  *
- * @param Copy_pau8Data Pointer to an array of 8 bytes representing the data for each column.
+ * Called from the tick interrupt, one column per call. The pending frame handed by LEDMTRX_Display()
+ * becomes the front frame when the scan wraps back to column 0.
  *
- * @return void
+ * @return None.
+ */
+void LEDMTRX_RefreshTick(void);
+
+/**
+ * @brief Gets the refresh statistics.
+ *
+ * @param Copy_Stats Pointer to the structure receiving the statistics.
+ *
+ * @return None.
+ */
+void LEDMTRX_GetRefreshStats(LEDMTRX_RefreshStats_t *Copy_Stats);
+
+/**
+ * @brief Resets the refresh statistics.
+ *
+ * @return None.
+ */
+void LEDMTRX_ResetRefreshStats(void);
+
+/**
+ * @brief Scrolls a column stream through the matrix.
+ *
+ * The refresh reads the stream in place through a circular offset, advancing it by one column every
+ * Copy_StepMs, so a scroll step costs the same whatever the stream length. The stream is taken at the
+ * next frame boundary and must stay valid until LEDMTRX_StopScroll(); frames handed by LEDMTRX_Display()
+ * are not shown while it scrolls.
+ *
+ * @param Copy_Columns Pointer to the stream, one byte per column, bit n drives row n.
+ * @param Copy_Length The number of columns in the stream, at least LEDMTRX_CANVAS_COLS.
+ * @param Copy_StepMs The time between two scroll steps in milliseconds, rounded to whole frames.
+ *
+ * @return None.
+ */
+void LEDMTRX_ScrollColumns(const u8 *Copy_Columns, u16 Copy_Length, u16 Copy_StepMs);
+
+/**
+ * @brief Renders a text with the 5x7 font and scrolls it through the matrix.
+ *
+ * @param Copy_Text The null terminated text.
+ * @param Copy_Buffer Pointer to the buffer receiving the column stream, it must stay valid while the text scrolls.
+ * @param Copy_BufferSize The buffer size in bytes, LEDMTRX_SCROLL_BUFFER_SIZE() of the text length; a longer text is cut.
+ * @param Copy_StepMs The time between two scroll steps in milliseconds.
+ *
+ * @return None.
+ */
+void LEDMTRX_ScrollText(const char *Copy_Text, u8 *Copy_Buffer, u16 Copy_BufferSize, u16 Copy_StepMs);
+
+/**
+ * @brief Stops the scrolling at the next frame boundary and shows the last frame handed by LEDMTRX_Display().
+ *
+ * @return None.
  */
-void LEDMTRX_Display(u8 *Copy_pau8Data);
+void LEDMTRX_StopScroll(void);
 
 /**
  * @brief Set the state of an LED at a specific row and column in the LED matrix.
  * 
- * This function sets the state of the LED at the specified row and column in the LED matrix.
+ * This function sets the state of the LED at the specified row and column in the draw frame.
  * 
- * @param row The row number of the LED (0-indexed).
- * @param col The column number of the LED (0-indexed).
- * @param state The state to set the LED to (0 for off, 1 for on).
+ * @param Copy_Row The row number of the LED (0-indexed).
+ * @param Copy_Col The canvas column number of the LED (0-indexed).
+ * @param Copy_State The state to set the LED to (0 for off, 1 for on).
  * @return None.
  */
-void LEDMTRX_SetLedState(u8 row, u8 col, u8 state);
+void LEDMTRX_SetLedState(u8 Copy_Row, u8 Copy_Col, u8 Copy_State);
 
 /**
  * @brief Shift the LED matrix display to the left by one column.
@@ -88,12 +233,12 @@ void LEDMTRX_ShiftLeft(u8 *Copy_pau8Data);
 /**
  * @brief Set the state of a specific row in the LED matrix.
  * 
- * This function sets the state of all LEDs in a specific row of the LED matrix.
+ * This function sets the state of all LEDs in a specific row of the draw frame.
  * 
- * @param row The row number to set the state for (0-indexed).
- * @param state The state to set the row to (0 for off, 1 for on).
+ * @param Copy_Row The row number to set the state for (0-indexed).
+ * @param Copy_State The state to set the row to (0 for off, 1 for on).
  * @return None.
  */
-void LEDMTRX_SetRowState(u8 row, u8 state);
+void LEDMTRX_SetRowState(u8 Copy_Row, u8 Copy_State);
 
 #endif /**< __LEDMATRIX_INTERFACE_H__ */
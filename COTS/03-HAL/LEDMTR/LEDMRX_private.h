@@ -14,10 +14,149 @@
 #define __LEDMATRIX_PRIVATE_H__
 
 
+/**
+ * @brief Options of LEDMTRX_REFRESH_SOURCE.
+ */
+#define LEDMTRX_REFRESH_SOURCE_STK          0
+#define LEDMTRX_REFRESH_SOURCE_EXTERNAL     1
+
+/**
+ * @brief Options of LEDMTRX_JITTER_STATS.
+ */
+#define LEDMTRX_JITTER_STATS_DISABLE        0
+#define LEDMTRX_JITTER_STATS_ENABLE         1
+
+/**
+ * @brief Options of LEDMTRX_DRIVER.
+ */
+#define LEDMTRX_DRIVER_GPIO                 0
+#define LEDMTRX_DRIVER_MAX7219              1
+
+/**
+ * @brief MAX7219 registers, digit n is register LEDMTRX_MAX7219_DIGIT0 + n.
+ */
+#define LEDMTRX_MAX7219_DIGIT0              0x01
+#define LEDMTRX_MAX7219_DECODE_MODE         0x09
+#define LEDMTRX_MAX7219_INTENSITY           0x0A
+#define LEDMTRX_MAX7219_SCAN_LIMIT          0x0B
+#define LEDMTRX_MAX7219_SHUTDOWN            0x0C
+#define LEDMTRX_MAX7219_DISPLAY_TEST        0x0F
+
+/**
+ * @brief Marks no pending MAX7219 intensity update.
+ */
+#define LEDMTRX_NO_INTENSITY                0xFF
+
+/**
+ * @brief Options of LEDMTRX_GRAYSCALE.
+ */
+#define LEDMTRX_GRAYSCALE_DISABLE           0
+#define LEDMTRX_GRAYSCALE_ENABLE            1
+
+/**
+ * @brief Binary code modulation geometry: bit planes, brightest level and sub-slots per column (planes and a blank one).
+ */
+#define LEDMTRX_BCM_BITS                    4
+#define LEDMTRX_BCM_LEVEL_MAX               ((1 << LEDMTRX_BCM_BITS) - 1)
+#define LEDMTRX_BCM_SLOTS                   (LEDMTRX_BCM_BITS + 1)
+
+/**
+ * @brief Bit planes stored per frame, only the most significant one without grayscale.
+ */
+#define LEDMTRX_PLANES                      ((LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE) ? LEDMTRX_BCM_BITS : 1)
+
+/**
+ * @brief The period in microseconds between two column switches.
+ */
+#define LEDMTRX_COLUMN_PERIOD_US            (1000000UL / ((u32)LEDMTRX_REFRESH_RATE_HZ * LEDMTRX_NUM_COLS))
+
+/**
+ * @brief A GPIO port and pin pair, so the pins can be indexed by column in the tick.
+ */
+typedef struct
+{
+  u8 Port;
+  u8 Pin;
+} LEDMTRX_Pin_t;
+
+/**
+ * @brief Marks a row pins map that is not contiguous on its port.
+ */
+#define LEDMTRX_ROWS_NOT_CONTIGUOUS         0xFF
+
+/**
+ * @brief Gets the data of a column of the frame being scanned, from the scroll stream when it scrolls.
+ *
+ * @param Copy_Column The column number (0-indexed).
+ * @param Copy_Plane The bit plane, 0 without grayscale.
+ * @return The row values of the column.
+ */
+static u8 LEDMTRX_GetColumnData(u8 Copy_Column, u8 Copy_Plane);
+
+/**
+ * @brief Moves to the next column, handling the frame boundary.
+ *
+ * @return The new column number.
+ */
+static u8 LEDMTRX_NextColumn(void);
+
+#if LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE
+/**
+ * @brief Computes the sub-slot lengths of the binary code modulation for a brightness.
+ *
+ * @param Copy_Brightness The global brightness, 0 to 255.
+ */
+static void LEDMTRX_UpdateSlotDurations(u8 Copy_Brightness);
+#endif
+
+/**
+ * @brief Takes the pending scroll request or advances the scroll, called at each frame boundary.
+ */
+static void LEDMTRX_UpdateScroll(void);
+
+#if LEDMTRX_DRIVER == LEDMTRX_DRIVER_GPIO
 static void LEDMTRX_DisableAllCols(void);
 
 static void LEDMTRX_SetRowValues(u8 Copy_u8Value);
 
+/**
+ * @brief Turns one column on.
+ *
+ * @param Copy_Column The column number (0-indexed).
+ */
+static void LEDMTRX_EnableCol(u8 Copy_Column);
+
+/**
+ * @brief Turns one column off.
+ *
+ * @param Copy_Column The column number (0-indexed).
+ */
+static void LEDMTRX_DisableCol(u8 Copy_Column);
+
+/**
+ * @brief Precomputes the port masks of the rows and columns.
+ *
+ * When all the rows (or all the columns) are on the same port, their updates become a single BSRR store.
+ * Otherwise the BSRR address stays NULL and the pins are written one by one.
+ */
+static void LEDMTRX_PreparePortMasks(void);
+#elif LEDMTRX_DRIVER == LEDMTRX_DRIVER_MAX7219
+/**
+ * @brief Sends one column of every panel in a single SPI burst.
+ *
+ * @param Copy_Column The column number in the panels (0-indexed).
+ */
+static void LEDMTRX_Max7219PushColumn(u8 Copy_Column);
+
+/**
+ * @brief Writes the same register of every MAX7219 of the chain.
+ *
+ * @param Copy_Register The register address.
+ * @param Copy_Data The register value.
+ */
+static void LEDMTRX_Max7219Broadcast(u8 Copy_Register, u8 Copy_Data);
+#endif
+
 /*****************************< Concatenate function *****************************/
 #define Conc(NUM)			Conc_Help(NUM)
 #define Conc_Help(NUM)		LEDMTRX_COL##NUM##_PIN
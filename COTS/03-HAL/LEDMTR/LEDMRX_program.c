@@ -13,32 +13,206 @@
 #include "BIT_MATH.h"
 /*********************< MCAL *********************/
 #include "GPIO_interface.h"
+#include "SPI_interface.h"
 #include "STK_interface.h"
+/*********************< SERVICES *********************/
+#include "FONT_interface.h"
 /*********************< HAL *********************/
-#include "LEDMRX_private.h"
 #include "LEDMRX_interface.h"
 #include "LEDMRX_config.h"
+#include "LEDMRX_private.h"
+
+#if (LEDMTRX_NUM_ROWS != 8) || (LEDMTRX_NUM_COLS != 8)
+  #error "The row and column pins tables and the MAX7219 cover 8x8 matrices"
+#endif
+
+#if (LEDMTRX_DRIVER == LEDMTRX_DRIVER_GPIO) && (LEDMTRX_NUM_PANELS != 1)
+  #error "The GPIO driver drives a single panel, chain panels with LEDMTRX_DRIVER_MAX7219"
+#endif
+
+#if (LEDMTRX_DRIVER == LEDMTRX_DRIVER_MAX7219) && (LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE)
+  #error "The MAX7219 scans the LEDs itself, the grayscale needs LEDMTRX_DRIVER_GPIO"
+#endif
+
+#if (LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE) && (LEDMTRX_REFRESH_SOURCE != LEDMTRX_REFRESH_SOURCE_STK)
+  #error "The grayscale sub-slots need the SysTick refresh source"
+#endif
+
+#if LEDMTRX_DRIVER == LEDMTRX_DRIVER_GPIO
+/**< Row pins indexed by the row number */
+static const LEDMTRX_Pin_t LEDMTRX_RowPins[LEDMTRX_NUM_ROWS] =
+{
+  {LEDMTRX_ROW0_PIN}, {LEDMTRX_ROW1_PIN}, {LEDMTRX_ROW2_PIN}, {LEDMTRX_ROW3_PIN},
+  {LEDMTRX_ROW4_PIN}, {LEDMTRX_ROW5_PIN}, {LEDMTRX_ROW6_PIN}, {LEDMTRX_ROW7_PIN}
+};
+
+/**< Column pins indexed by the column number */
+static const LEDMTRX_Pin_t LEDMTRX_ColPins[LEDMTRX_NUM_COLS] =
+{
+  {LEDMTRX_COL0_PIN}, {LEDMTRX_COL1_PIN}, {LEDMTRX_COL2_PIN}, {LEDMTRX_COL3_PIN},
+  {LEDMTRX_COL4_PIN}, {LEDMTRX_COL5_PIN}, {LEDMTRX_COL6_PIN}, {LEDMTRX_COL7_PIN}
+};
+#endif
+
+/**< Front and back frames, one byte per column and bit plane */
+static u8 LEDMTRX_Frames[2][LEDMTRX_PLANES][LEDMTRX_CANVAS_COLS];
+
+/**< Frame the drawing functions work on, never read by the refresh */
+static u8 LEDMTRX_DrawFrame[LEDMTRX_PLANES][LEDMTRX_CANVAS_COLS];
+
+/**< Index of the frame being scanned */
+static volatile u8 LEDMTRX_FrontIndex = 0;
+
+/**< Set when the back frame holds a new frame to show */
+static volatile u8 LEDMTRX_SwapPending = 0;
+
+/**< Column currently on */
+static volatile u8 LEDMTRX_CurrentColumn = 0;
+
+/**< Set while the background refresh is running */
+static volatile u8 LEDMTRX_RefreshRunning = 0;
+
+/**< Refresh statistics */
+static LEDMTRX_RefreshStats_t LEDMTRX_Stats;
 
+/**< Rows mask, cleared when the brightness is 0 */
+static volatile u8 LEDMTRX_RowEnable = 0xFF;
 
+#if LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE
+/**< Sub-slot being shown: a bit plane, or LEDMTRX_BCM_BITS for the blank one */
+static volatile u8 LEDMTRX_CurrentSlot = LEDMTRX_BCM_BITS;
 
+/**< Length in microseconds of each sub-slot */
+static u16 LEDMTRX_SlotUs[LEDMTRX_BCM_SLOTS];
+#endif
 
-void LEDMTRX_TurnOn(u8 Copy_u8Row, u8 Copy_u8Col)
+/**< Column stream being scrolled, NULL when the frames are shown */
+static const u8 *LEDMTRX_ScrollStream = NULL;
+
+/**< Number of columns in the scroll stream */
+static u16 LEDMTRX_ScrollLength = 0;
+
+/**< Stream column shown in matrix column 0 */
+static u16 LEDMTRX_ScrollOffset = 0;
+
+/**< Frames per scroll step and frames since the last step */
+static u16 LEDMTRX_ScrollStepFrames = 1;
+static u16 LEDMTRX_ScrollFrameCount = 0;
+
+/**< Scroll request waiting for the next frame boundary */
+static const u8 *volatile LEDMTRX_NextScrollStream = NULL;
+static volatile u16 LEDMTRX_NextScrollLength = 0;
+static volatile u16 LEDMTRX_NextScrollStepFrames = 1;
+static volatile u8 LEDMTRX_ScrollPending = 0;
+
+#if LEDMTRX_DRIVER == LEDMTRX_DRIVER_GPIO
+/**< BSRR of the rows port, NULL when the rows are spread over several ports */
+static volatile u32 *LEDMTRX_RowBsrr = NULL;
+
+/**< Mask of all the row pins on their port */
+static u32 LEDMTRX_RowMask = 0;
+
+/**< Pin of row 0 when the rows are contiguous, LEDMTRX_ROWS_NOT_CONTIGUOUS otherwise */
+static u8 LEDMTRX_RowShift = LEDMTRX_ROWS_NOT_CONTIGUOUS;
+
+/**< BSRR of the columns port, NULL when the columns are spread over several ports */
+static volatile u32 *LEDMTRX_ColBsrr = NULL;
+
+/**< Mask of all the column pins on their port */
+static u32 LEDMTRX_ColMask = 0;
+#elif LEDMTRX_DRIVER == LEDMTRX_DRIVER_MAX7219
+/**< SPI peripheral of the chain */
+static SPI_t LEDMTRX_Spi;
+
+/**< One register write per panel, the farthest panel first */
+static u8 LEDMTRX_Burst[2 * LEDMTRX_NUM_PANELS];
+
+/**< Intensity waiting for the tick, the SPI belongs to it while the refresh runs */
+static volatile u8 LEDMTRX_PendingIntensity = LEDMTRX_NO_INTENSITY;
+#endif
+
+void LEDMTRX_TurnOn(u8 Copy_Row, u8 Copy_Col)
 {
- 
+  if ((Copy_Row >= LEDMTRX_NUM_ROWS) || (Copy_Col >= LEDMTRX_CANVAS_COLS))
+  {
+    /**< RETURN ERROR STATUS */
+    return;
+  }
+
+  /**< Full intensity, the bit is set in every plane */
+  for (u8 Local_PlaneIterator = 0; Local_PlaneIterator < LEDMTRX_PLANES; Local_PlaneIterator++)
+  {
+    SET_BIT(LEDMTRX_DrawFrame[Local_PlaneIterator][Copy_Col], Copy_Row);
+  }
 }
 
-void LEDMTRX_TurnOff(u8 Copy_u8Row, u8 Copy_u8Col)
+void LEDMTRX_TurnOff(u8 Copy_Row, u8 Copy_Col)
 {
-  
+  if ((Copy_Row >= LEDMTRX_NUM_ROWS) || (Copy_Col >= LEDMTRX_CANVAS_COLS))
+  {
+    /**< RETURN ERROR STATUS */
+    return;
+  }
+
+  for (u8 Local_PlaneIterator = 0; Local_PlaneIterator < LEDMTRX_PLANES; Local_PlaneIterator++)
+  {
+    CLR_BIT(LEDMTRX_DrawFrame[Local_PlaneIterator][Copy_Col], Copy_Row);
+  }
+}
+
+void LEDMTRX_SetLedState(u8 Copy_Row, u8 Copy_Col, u8 Copy_State)
+{
+  if (Copy_State)
+  {
+    LEDMTRX_TurnOn(Copy_Row, Copy_Col);
+  }
+  else
+  {
+    LEDMTRX_TurnOff(Copy_Row, Copy_Col);
+  }
+}
+
+void LEDMTRX_SetRowState(u8 Copy_Row, u8 Copy_State)
+{
+  for (u16 Local_ColsIterator = 0; Local_ColsIterator < LEDMTRX_CANVAS_COLS; Local_ColsIterator++)
+  {
+    LEDMTRX_SetLedState(Copy_Row, (u8)Local_ColsIterator, Copy_State);
+  }
 }
 
 void LEDMTRX_Clear(void)
 {
-  
+  for (u8 Local_PlaneIterator = 0; Local_PlaneIterator < LEDMTRX_PLANES; Local_PlaneIterator++)
+  {
+    for (u16 Local_ColsIterator = 0; Local_ColsIterator < LEDMTRX_CANVAS_COLS; Local_ColsIterator++)
+    {
+      LEDMTRX_DrawFrame[Local_PlaneIterator][Local_ColsIterator] = 0;
+    }
+  }
+}
+
+void LEDMTRX_Update(void)
+{
+  u8 Local_BackIndex;
+
+  /**< Hold the swap back while the back frame is written, the tick only swaps a pending frame */
+  LEDMTRX_SwapPending = 0;
+  Local_BackIndex = LEDMTRX_FrontIndex ^ 1;
+
+  for (u8 Local_PlaneIterator = 0; Local_PlaneIterator < LEDMTRX_PLANES; Local_PlaneIterator++)
+  {
+    for (u16 Local_ColsIterator = 0; Local_ColsIterator < LEDMTRX_CANVAS_COLS; Local_ColsIterator++)
+    {
+      LEDMTRX_Frames[Local_BackIndex][Local_PlaneIterator][Local_ColsIterator] = LEDMTRX_DrawFrame[Local_PlaneIterator][Local_ColsIterator];
+    }
+  }
+
+  LEDMTRX_SwapPending = 1;
 }
 
 void LEDMTRX_Init(void)
 {
+#if LEDMTRX_DRIVER == LEDMTRX_DRIVER_GPIO
   /**< Set Rows as output push-pull with 2MHZ */
   GPIO_SetPinMode(LEDMTRX_ROW0_PIN, GPIO_OUTPUT_PP_2MHZ);
   GPIO_SetPinMode(LEDMTRX_ROW1_PIN, GPIO_OUTPUT_PP_2MHZ);
@@ -58,123 +232,559 @@ void LEDMTRX_Init(void)
   GPIO_SetPinMode(LEDMTRX_COL5_PIN, GPIO_OUTPUT_PP_2MHZ);
   GPIO_SetPinMode(LEDMTRX_COL6_PIN, GPIO_OUTPUT_PP_2MHZ);
   GPIO_SetPinMode(LEDMTRX_COL7_PIN, GPIO_OUTPUT_PP_2MHZ);
+
+  /**< Choose between the single store and the per pin updates */
+  LEDMTRX_PreparePortMasks();
+
+  LEDMTRX_SetBrightness(LEDMTRX_DEFAULT_BRIGHTNESS);
+
+  /**< Start with all the columns off */
+  LEDMTRX_DisableAllCols();
+#elif LEDMTRX_DRIVER == LEDMTRX_DRIVER_MAX7219
+  /**< LOAD idles high, the rising edge latches the burst */
+  GPIO_SetPinMode(LEDMTRX_CS_PIN, GPIO_OUTPUT_PP_2MHZ);
+  GPIO_SetPinValue(LEDMTRX_CS_PIN, GPIO_HIGH);
+  LEDMTRX_Spi = SPI_SelectSpiPeripheral(LEDMTRX_SPI_PERIPHERAL);
+
+  /**< Raw segments on 8 digits, blank until the refresh starts */
+  LEDMTRX_Max7219Broadcast(LEDMTRX_MAX7219_DISPLAY_TEST, 0);
+  LEDMTRX_Max7219Broadcast(LEDMTRX_MAX7219_DECODE_MODE, 0);
+  LEDMTRX_Max7219Broadcast(LEDMTRX_MAX7219_SCAN_LIMIT, LEDMTRX_NUM_COLS - 1);
+  LEDMTRX_Max7219Broadcast(LEDMTRX_MAX7219_SHUTDOWN, 0);
+#else
+  #error "Wrong choice of LED matrix driver"
+#endif
 }
 
-void LEDMTRX_Display(u8 *Copy_Data)
+void LEDMTRX_Display(const u8 *Copy_Data)
 {
-  /****************************< Column 0 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 0 Date */
-  LEDMTRX_SetRowValues(Copy_Data[0]);
-  /**< Enable Column 0 */
-  GPIO_SetPinValue(LEDMTRX_COL0_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 1 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[1]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL1_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 2 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 2 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[2]);
-  /**< Enable Column 2 */
-  GPIO_SetPinValue(LEDMTRX_COL2_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 3 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[3]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL3_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 4 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[4]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL4_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 5 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[5]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL5_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 6 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[6]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL6_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 7 ****************************/
-  /**< Disable All Columns */
+  if (Copy_Data == NULL)
+  {
+    /**< RETURN ERROR STATUS */
+    return;
+  }
+
+  /**< On/off data is full intensity, the same in every bit plane */
+  for (u8 Local_PlaneIterator = 0; Local_PlaneIterator < LEDMTRX_PLANES; Local_PlaneIterator++)
+  {
+    for (u16 Local_ColsIterator = 0; Local_ColsIterator < LEDMTRX_CANVAS_COLS; Local_ColsIterator++)
+    {
+      LEDMTRX_DrawFrame[Local_PlaneIterator][Local_ColsIterator] = Copy_Data[Local_ColsIterator];
+    }
+  }
+
+  LEDMTRX_Update();
+}
+
+void LEDMTRX_DisplayGray(const u8 *Copy_Levels)
+{
+  u8 Local_Bit;
+  u8 Local_Value;
+
+  if (Copy_Levels == NULL)
+  {
+    /**< RETURN ERROR STATUS */
+    return;
+  }
+
+  /**< Slice the levels into bit planes once here, the tick then only copies a byte to the rows */
+  for (u8 Local_PlaneIterator = 0; Local_PlaneIterator < LEDMTRX_PLANES; Local_PlaneIterator++)
+  {
+    Local_Bit = LEDMTRX_BCM_BITS - LEDMTRX_PLANES + Local_PlaneIterator;
+
+    for (u16 Local_ColsIterator = 0; Local_ColsIterator < LEDMTRX_CANVAS_COLS; Local_ColsIterator++)
+    {
+      Local_Value = 0;
+      for (u8 Local_RowsIterator = 0; Local_RowsIterator < LEDMTRX_NUM_ROWS; Local_RowsIterator++)
+      {
+        if (GET_BIT(Copy_Levels[(Local_RowsIterator * LEDMTRX_CANVAS_COLS) + Local_ColsIterator], Local_Bit))
+        {
+          SET_BIT(Local_Value, Local_RowsIterator);
+        }
+      }
+      LEDMTRX_DrawFrame[Local_PlaneIterator][Local_ColsIterator] = Local_Value;
+    }
+  }
+
+  LEDMTRX_Update();
+}
+
+void LEDMTRX_SetBrightness(u8 Copy_Brightness)
+{
+  LEDMTRX_RowEnable = (Copy_Brightness == 0) ? 0x00 : 0xFF;
+
+#if LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE
+  LEDMTRX_UpdateSlotDurations(Copy_Brightness);
+#endif
+
+#if LEDMTRX_DRIVER == LEDMTRX_DRIVER_MAX7219
+  /**< 16 intensity steps in the MAX7219 */
+  if (LEDMTRX_RefreshRunning)
+  {
+    LEDMTRX_PendingIntensity = Copy_Brightness >> 4;
+  }
+  else
+  {
+    LEDMTRX_Max7219Broadcast(LEDMTRX_MAX7219_INTENSITY, Copy_Brightness >> 4);
+  }
+#endif
+}
+
+void LEDMTRX_StartRefresh(void)
+{
+  LEDMTRX_ResetRefreshStats();
+
+#if LEDMTRX_DRIVER == LEDMTRX_DRIVER_MAX7219
+  LEDMTRX_Max7219Broadcast(LEDMTRX_MAX7219_SHUTDOWN, 1);
+#endif
+
+  LEDMTRX_RefreshRunning = 1;
+
+#if LEDMTRX_REFRESH_SOURCE == LEDMTRX_REFRESH_SOURCE_STK
+  STK_Init();
+#if LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE
+  /**< The first tick starts the first sub-slot of the next column */
+  LEDMTRX_CurrentSlot = LEDMTRX_BCM_BITS;
+  STK_SetIntervalPeriodic(LEDMTRX_SlotUs[0], LEDMTRX_RefreshTick);
+#else
+  STK_SetIntervalPeriodic(LEDMTRX_COLUMN_PERIOD_US, LEDMTRX_RefreshTick);
+#endif
+#elif LEDMTRX_REFRESH_SOURCE == LEDMTRX_REFRESH_SOURCE_EXTERNAL
+  /**< The application calls LEDMTRX_RefreshTick() every LEDMTRX_COLUMN_PERIOD_US */
+#else
+  #error "Wrong choice of LED matrix refresh source"
+#endif
+}
+
+void LEDMTRX_StopRefresh(void)
+{
+  LEDMTRX_RefreshRunning = 0;
+
+#if LEDMTRX_REFRESH_SOURCE == LEDMTRX_REFRESH_SOURCE_STK
+  /**< Only the refresh interval, the SysTick may carry the time base */
+  STK_CancelInterval(LEDMTRX_RefreshTick);
+#endif
+
+#if LEDMTRX_DRIVER == LEDMTRX_DRIVER_GPIO
   LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[7]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL7_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5); 
-  /****************************< Shift left the data ****************************/
-  HLEDMTRX_voidShiftLeft(Copy_Data);
-  /****************************< Set Delay ****************************/
-  STK_SetDelay(500);
+#elif LEDMTRX_DRIVER == LEDMTRX_DRIVER_MAX7219
+  LEDMTRX_Max7219Broadcast(LEDMTRX_MAX7219_SHUTDOWN, 0);
+#endif
 }
 
+void LEDMTRX_RefreshTick(void)
+{
+#if LEDMTRX_JITTER_STATS == LEDMTRX_JITTER_STATS_ENABLE
+  /**< Counts since the tick fired, read first so the measurement covers only the entry latency. The running period
+   *   is the one that fired, LOAD already holds the next sub-slot with grayscale */
+  u32 Local_Latency = STK_GetIntervalElapsedCounts();
+#endif
+  u8 Local_Column;
+#if LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE
+  u8 Local_Slot;
+#endif
+
+  if (!LEDMTRX_RefreshRunning)
+  {
+    return;
+  }
+
+#if LEDMTRX_DRIVER == LEDMTRX_DRIVER_MAX7219
+  /**< The chips hold and scan the data, the tick only streams one column of every panel */
+  Local_Column = LEDMTRX_NextColumn();
+  LEDMTRX_Max7219PushColumn(Local_Column);
+
+  if (LEDMTRX_PendingIntensity != LEDMTRX_NO_INTENSITY)
+  {
+    LEDMTRX_Max7219Broadcast(LEDMTRX_MAX7219_INTENSITY, LEDMTRX_PendingIntensity);
+    LEDMTRX_PendingIntensity = LEDMTRX_NO_INTENSITY;
+  }
+#elif LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE
+  Local_Slot = LEDMTRX_CurrentSlot + 1;
+  if (Local_Slot == LEDMTRX_BCM_SLOTS)
+  {
+    /**< New column (the previous one is off since the blank sub-slot), rows of the weight 1 plane then column on */
+    Local_Slot = 0;
+    Local_Column = LEDMTRX_NextColumn();
+    LEDMTRX_SetRowValues(LEDMTRX_GetColumnData(Local_Column, 0));
+    LEDMTRX_EnableCol(Local_Column);
+  }
+  else if (Local_Slot < LEDMTRX_BCM_BITS)
+  {
+    /**< Next bit plane on the same column, a single rows update */
+    LEDMTRX_SetRowValues(LEDMTRX_GetColumnData(LEDMTRX_CurrentColumn, Local_Slot));
+  }
+  else
+  {
+    /**< Blank sub-slot, what is left of the column time after the brightness scaled planes */
+    LEDMTRX_DisableCol(LEDMTRX_CurrentColumn);
+  }
+  LEDMTRX_CurrentSlot = Local_Slot;
+
+  /**< The reload value written now is the length of the sub-slot after this one */
+  Local_Slot++;
+  if (Local_Slot == LEDMTRX_BCM_SLOTS)
+  {
+    Local_Slot = 0;
+  }
+  STK_SetNextInterval(LEDMTRX_SlotUs[Local_Slot]);
+#else
+  /**< Turn the current column off before the rows change, otherwise the next data ghosts on it */
+  LEDMTRX_DisableCol(LEDMTRX_CurrentColumn);
+
+  /**< Set the rows of the new column then turn it on */
+  Local_Column = LEDMTRX_NextColumn();
+  LEDMTRX_SetRowValues(LEDMTRX_GetColumnData(Local_Column, 0));
+  LEDMTRX_EnableCol(Local_Column);
+#endif
+
+#if LEDMTRX_JITTER_STATS == LEDMTRX_JITTER_STATS_ENABLE
+  LEDMTRX_Stats.LastLatency = Local_Latency;
+  if (Local_Latency < LEDMTRX_Stats.MinLatency)
+  {
+    LEDMTRX_Stats.MinLatency = Local_Latency;
+  }
+  if (Local_Latency > LEDMTRX_Stats.MaxLatency)
+  {
+    LEDMTRX_Stats.MaxLatency = Local_Latency;
+  }
+#endif
+}
 
+void LEDMTRX_ScrollColumns(const u8 *Copy_Columns, u16 Copy_Length, u16 Copy_StepMs)
+{
+  u32 Local_StepFrames;
+
+  if ((Copy_Columns == NULL) || (Copy_Length < LEDMTRX_CANVAS_COLS))
+  {
+    /**< RETURN ERROR STATUS */
+    return;
+  }
+
+  /**< Round the step to whole frames, at least one */
+  Local_StepFrames = (((u32)Copy_StepMs * LEDMTRX_REFRESH_RATE_HZ) + 500) / 1000;
+  if (Local_StepFrames == 0)
+  {
+    Local_StepFrames = 1;
+  }
+  else if (Local_StepFrames > 0xFFFF)
+  {
+    Local_StepFrames = 0xFFFF;
+  }
+
+  /**< Hold the request back while it is written, the tick takes it at the next frame boundary */
+  LEDMTRX_ScrollPending = 0;
+  LEDMTRX_NextScrollStream = Copy_Columns;
+  LEDMTRX_NextScrollLength = Copy_Length;
+  LEDMTRX_NextScrollStepFrames = (u16)Local_StepFrames;
+  LEDMTRX_ScrollPending = 1;
+}
+
+void LEDMTRX_ScrollText(const char *Copy_Text, u8 *Copy_Buffer, u16 Copy_BufferSize, u16 Copy_StepMs)
+{
+  u16 Local_Length = 0;
+  const u8 *Local_Glyph;
+
+  if ((Copy_Text == NULL) || (Copy_Buffer == NULL) || (Copy_BufferSize < LEDMTRX_CANVAS_COLS))
+  {
+    /**< RETURN ERROR STATUS */
+    return;
+  }
+
+  /**< Render the characters that fit before the trailing blank canvas width */
+  while ((*Copy_Text != '\0') && ((Local_Length + LEDMTRX_SCROLL_CHAR_COLS + LEDMTRX_CANVAS_COLS) <= Copy_BufferSize))
+  {
+    Local_Glyph = FONT_GetGlyph5x7((u8)*Copy_Text);
+    for (u8 Local_GlyphIterator = 0; Local_GlyphIterator < FONT_5X7_WIDTH; Local_GlyphIterator++)
+    {
+      Copy_Buffer[Local_Length++] = Local_Glyph[Local_GlyphIterator];
+    }
+    Copy_Buffer[Local_Length++] = 0;
+    Copy_Text++;
+  }
+
+  for (u16 Local_ColsIterator = 0; Local_ColsIterator < LEDMTRX_CANVAS_COLS; Local_ColsIterator++)
+  {
+    Copy_Buffer[Local_Length++] = 0;
+  }
+
+  LEDMTRX_ScrollColumns(Copy_Buffer, Local_Length, Copy_StepMs);
+}
+
+void LEDMTRX_StopScroll(void)
+{
+  LEDMTRX_ScrollPending = 0;
+  LEDMTRX_NextScrollStream = NULL;
+  LEDMTRX_ScrollPending = 1;
+}
+
+void LEDMTRX_GetRefreshStats(LEDMTRX_RefreshStats_t *Copy_Stats)
+{
+  if (Copy_Stats == NULL)
+  {
+    /**< RETURN ERROR STATUS */
+    return;
+  }
+
+  *Copy_Stats = LEDMTRX_Stats;
+}
+
+void LEDMTRX_ResetRefreshStats(void)
+{
+  LEDMTRX_Stats.Frames = 0;
+  LEDMTRX_Stats.LastLatency = 0;
+  LEDMTRX_Stats.MinLatency = 0xFFFFFFFF;
+  LEDMTRX_Stats.MaxLatency = 0;
+}
+
+
+static u8 LEDMTRX_NextColumn(void)
+{
+  u8 Local_Column = LEDMTRX_CurrentColumn;
+
+  Local_Column++;
+  if (Local_Column == LEDMTRX_NUM_COLS)
+  {
+    Local_Column = 0;
+    LEDMTRX_Stats.Frames++;
+
+    /**< Frame boundary, take the pending frame */
+    if (LEDMTRX_SwapPending)
+    {
+      LEDMTRX_FrontIndex ^= 1;
+      LEDMTRX_SwapPending = 0;
+    }
+
+    LEDMTRX_UpdateScroll();
+  }
+  LEDMTRX_CurrentColumn = Local_Column;
+
+  return Local_Column;
+}
+
+
+static u8 LEDMTRX_GetColumnData(u8 Copy_Column, u8 Copy_Plane)
+{
+  u16 Local_Index;
+
+  if (LEDMTRX_ScrollStream == NULL)
+  {
+    return LEDMTRX_Frames[LEDMTRX_FrontIndex][Copy_Plane][Copy_Column] & LEDMTRX_RowEnable;
+  }
+
+  /**< Circular read through the stream, the length is at least the matrix width so one wrap is enough */
+  Local_Index = LEDMTRX_ScrollOffset + Copy_Column;
+  if (Local_Index >= LEDMTRX_ScrollLength)
+  {
+    Local_Index -= LEDMTRX_ScrollLength;
+  }
+
+  return LEDMTRX_ScrollStream[Local_Index] & LEDMTRX_RowEnable;
+}
+
+
+#if LEDMTRX_GRAYSCALE == LEDMTRX_GRAYSCALE_ENABLE
+static void LEDMTRX_UpdateSlotDurations(u8 Copy_Brightness)
+{
+  u32 Local_LitTime = 0;
+  u32 Local_Duration;
+
+  for (u8 Local_BitIterator = 0; Local_BitIterator < LEDMTRX_BCM_BITS; Local_BitIterator++)
+  {
+    /**< Plane n lasts 2^n of the 15 units the column is lit at full brightness */
+    Local_Duration = ((LEDMTRX_COLUMN_PERIOD_US - LEDMTRX_BCM_MIN_SLOT_US) * Copy_Brightness * ((u32)1 << Local_BitIterator)) / (LEDMTRX_BCM_LEVEL_MAX * 255UL);
+    if (Local_Duration < LEDMTRX_BCM_MIN_SLOT_US)
+    {
+      Local_Duration = LEDMTRX_BCM_MIN_SLOT_US;
+    }
+    LEDMTRX_SlotUs[Local_BitIterator] = (u16)Local_Duration;
+    Local_LitTime += Local_Duration;
+  }
+
+  /**< The blank sub-slot keeps the column period, and so the refresh rate, constant */
+  if ((Local_LitTime + LEDMTRX_BCM_MIN_SLOT_US) <= LEDMTRX_COLUMN_PERIOD_US)
+  {
+    LEDMTRX_SlotUs[LEDMTRX_BCM_BITS] = (u16)(LEDMTRX_COLUMN_PERIOD_US - Local_LitTime);
+  }
+  else
+  {
+    LEDMTRX_SlotUs[LEDMTRX_BCM_BITS] = LEDMTRX_BCM_MIN_SLOT_US;
+  }
+}
+#endif
+
+
+static void LEDMTRX_UpdateScroll(void)
+{
+  if (LEDMTRX_ScrollPending)
+  {
+    LEDMTRX_ScrollStream = LEDMTRX_NextScrollStream;
+    LEDMTRX_ScrollLength = LEDMTRX_NextScrollLength;
+    LEDMTRX_ScrollStepFrames = LEDMTRX_NextScrollStepFrames;
+    LEDMTRX_ScrollOffset = 0;
+    LEDMTRX_ScrollFrameCount = 0;
+    LEDMTRX_ScrollPending = 0;
+  }
+  else if (LEDMTRX_ScrollStream != NULL)
+  {
+    LEDMTRX_ScrollFrameCount++;
+    if (LEDMTRX_ScrollFrameCount >= LEDMTRX_ScrollStepFrames)
+    {
+      /**< One step is one index increment, nothing is copied */
+      LEDMTRX_ScrollFrameCount = 0;
+      LEDMTRX_ScrollOffset++;
+      if (LEDMTRX_ScrollOffset == LEDMTRX_ScrollLength)
+      {
+        LEDMTRX_ScrollOffset = 0;
+      }
+    }
+  }
+}
+
+
+#if LEDMTRX_DRIVER == LEDMTRX_DRIVER_GPIO
 static void LEDMTRX_DisableAllCols(void)
 {
-  GPIO_SetPinValue(LEDMTRX_COL0_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL1_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL2_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL3_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL4_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL5_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL6_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL7_PIN, GPIO_HIGH);
+  if (LEDMTRX_ColBsrr != NULL)
+  {
+    /**< Columns are active low, set them all in one store */
+    *LEDMTRX_ColBsrr = LEDMTRX_ColMask;
+  }
+  else
+  {
+    for (u8 Local_ColsIterator = 0; Local_ColsIterator < LEDMTRX_NUM_COLS; Local_ColsIterator++)
+    {
+      GPIO_SetPinValue(LEDMTRX_ColPins[Local_ColsIterator].Port, LEDMTRX_ColPins[Local_ColsIterator].Pin, GPIO_HIGH);
+    }
+  }
 }
 
 
 static void LEDMTRX_SetRowValues(u8 Copy_Value)
 {
-  u8 Local_BitValue = 0;
+  u32 Local_SetMask = 0;
+
+  if (LEDMTRX_RowBsrr != NULL)
+  {
+    if (LEDMTRX_RowShift != LEDMTRX_ROWS_NOT_CONTIGUOUS)
+    {
+      Local_SetMask = (u32)Copy_Value << LEDMTRX_RowShift;
+    }
+    else
+    {
+      for (u8 Local_RowsIterator = 0; Local_RowsIterator < LEDMTRX_NUM_ROWS; Local_RowsIterator++)
+      {
+        if (GET_BIT(Copy_Value, Local_RowsIterator))
+        {
+          Local_SetMask |= (u32)1 << LEDMTRX_RowPins[Local_RowsIterator].Pin;
+        }
+      }
+    }
+
+    /**< Reset all the rows and set the lit ones in one store, set wins over reset in BSRR */
+    *LEDMTRX_RowBsrr = (LEDMTRX_RowMask << 16) | Local_SetMask;
+  }
+  else
+  {
+    for (u8 Local_RowsIterator = 0; Local_RowsIterator < LEDMTRX_NUM_ROWS; Local_RowsIterator++)
+    {
+      GPIO_SetPinValue(LEDMTRX_RowPins[Local_RowsIterator].Port, LEDMTRX_RowPins[Local_RowsIterator].Pin, GET_BIT(Copy_Value, Local_RowsIterator));
+    }
+  }
+}
+
+
+static void LEDMTRX_EnableCol(u8 Copy_Column)
+{
+  if (LEDMTRX_ColBsrr != NULL)
+  {
+    *LEDMTRX_ColBsrr = ((u32)1 << LEDMTRX_ColPins[Copy_Column].Pin) << 16;
+  }
+  else
+  {
+    GPIO_SetPinValue(LEDMTRX_ColPins[Copy_Column].Port, LEDMTRX_ColPins[Copy_Column].Pin, GPIO_LOW);
+  }
+}
+
+
+static void LEDMTRX_DisableCol(u8 Copy_Column)
+{
+  if (LEDMTRX_ColBsrr != NULL)
+  {
+    *LEDMTRX_ColBsrr = (u32)1 << LEDMTRX_ColPins[Copy_Column].Pin;
+  }
+  else
+  {
+    GPIO_SetPinValue(LEDMTRX_ColPins[Copy_Column].Port, LEDMTRX_ColPins[Copy_Column].Pin, GPIO_HIGH);
+  }
+}
+
+
+static void LEDMTRX_PreparePortMasks(void)
+{
+  u8 Local_SamePort = 1;
 
-  Local_BitValue = GET_BIT(Copy_Value,0);
-  GPIO_SetPinValue(LEDMTRX_ROW0_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,1);
-  GPIO_SetPinValue(LEDMTRX_ROW1_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,2);
-  GPIO_SetPinValue(LEDMTRX_ROW2_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,3);
-  GPIO_SetPinValue(LEDMTRX_ROW3_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,4);
-  GPIO_SetPinValue(LEDMTRX_ROW4_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,5);
-  GPIO_SetPinValue(LEDMTRX_ROW5_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,6);
-  GPIO_SetPinValue(LEDMTRX_ROW6_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,7);
-  GPIO_SetPinValue(LEDMTRX_ROW7_PIN, Local_BitValue);
+  /**< Rows */
+  LEDMTRX_RowMask = 0;
+  LEDMTRX_RowShift = LEDMTRX_RowPins[0].Pin;
+  for (u8 Local_RowsIterator = 0; Local_RowsIterator < LEDMTRX_NUM_ROWS; Local_RowsIterator++)
+  {
+    if (LEDMTRX_RowPins[Local_RowsIterator].Port != LEDMTRX_RowPins[0].Port)
+    {
+      Local_SamePort = 0;
+    }
+    if (LEDMTRX_RowPins[Local_RowsIterator].Pin != (LEDMTRX_RowPins[0].Pin + Local_RowsIterator))
+    {
+      LEDMTRX_RowShift = LEDMTRX_ROWS_NOT_CONTIGUOUS;
+    }
+    LEDMTRX_RowMask |= (u32)1 << LEDMTRX_RowPins[Local_RowsIterator].Pin;
+  }
+  LEDMTRX_RowBsrr = Local_SamePort ? GPIO_GetSetResetRegister(LEDMTRX_RowPins[0].Port) : NULL;
+
+  /**< Columns */
+  Local_SamePort = 1;
+  LEDMTRX_ColMask = 0;
+  for (u8 Local_ColsIterator = 0; Local_ColsIterator < LEDMTRX_NUM_COLS; Local_ColsIterator++)
+  {
+    if (LEDMTRX_ColPins[Local_ColsIterator].Port != LEDMTRX_ColPins[0].Port)
+    {
+      Local_SamePort = 0;
+    }
+    LEDMTRX_ColMask |= (u32)1 << LEDMTRX_ColPins[Local_ColsIterator].Pin;
+  }
+  LEDMTRX_ColBsrr = Local_SamePort ? GPIO_GetSetResetRegister(LEDMTRX_ColPins[0].Port) : NULL;
 }
+#elif LEDMTRX_DRIVER == LEDMTRX_DRIVER_MAX7219
+static void LEDMTRX_Max7219PushColumn(u8 Copy_Column)
+{
+  u8 *Local_Burst = LEDMTRX_Burst;
+
+  /**< The first bytes shifted in end up in the farthest panel, so the panels are sent last to first */
+  for (u8 Local_PanelIterator = LEDMTRX_NUM_PANELS; Local_PanelIterator > 0; Local_PanelIterator--)
+  {
+    *Local_Burst++ = LEDMTRX_MAX7219_DIGIT0 + Copy_Column;
+    *Local_Burst++ = LEDMTRX_GetColumnData(((Local_PanelIterator - 1) * LEDMTRX_NUM_COLS) + Copy_Column, 0);
+  }
+
+  GPIO_SetPinValue(LEDMTRX_CS_PIN, GPIO_LOW);
+  SPI_voidTransmit(LEDMTRX_Spi, LEDMTRX_Burst, sizeof(LEDMTRX_Burst));
+  GPIO_SetPinValue(LEDMTRX_CS_PIN, GPIO_HIGH);
+}
+
+
+static void LEDMTRX_Max7219Broadcast(u8 Copy_Register, u8 Copy_Data)
+{
+  for (u8 Local_PanelIterator = 0; Local_PanelIterator < LEDMTRX_NUM_PANELS; Local_PanelIterator++)
+  {
+    LEDMTRX_Burst[2 * Local_PanelIterator] = Copy_Register;
+    LEDMTRX_Burst[(2 * Local_PanelIterator) + 1] = Copy_Data;
+  }
+
+  GPIO_SetPinValue(LEDMTRX_CS_PIN, GPIO_LOW);
+  SPI_voidTransmit(LEDMTRX_Spi, LEDMTRX_Burst, sizeof(LEDMTRX_Burst));
+  GPIO_SetPinValue(LEDMTRX_CS_PIN, GPIO_HIGH);
+}
+#endif
 
 
 void LEDMTRX_ShiftLeft(u8 *Copy_Data)
@@ -185,7 +795,7 @@ void LEDMTRX_ShiftLeft(u8 *Copy_Data)
   Local_Temp = Copy_Data[0];
 
   /**< Shift data left */ 
-  for (u8 Local_u8ColsIterator = 0; Local_u8ColsIterator < LEDMTRX_NUM_COLS; Local_u8ColsIterator++)
+  for (u8 Local_u8ColsIterator = 0; Local_u8ColsIterator < (LEDMTRX_NUM_COLS - 1); Local_u8ColsIterator++)
   {
     Copy_Data[Local_u8ColsIterator] = Copy_Data[Local_u8ColsIterator+1];
   }
@@ -195,16 +805,3 @@ void LEDMTRX_ShiftLeft(u8 *Copy_Data)
 
 }
 
-
-void LEDMTRX_DisplayWithShift(u8 *Copy_Data, u16 Copy_DelayMs)
-{
-  for(u8 i = 0; i < LEDMTRX_NUM_COLS; i++)
-  {
-    LEDMTRX_SetRowValues(Copy_Data[i]);
-    GPIO_SetPinValue(LEDMTRX_COL0_PIN + i, GPIO_LOW);
-    STK_SetDelay(Copy_DelayMs);
-    LEDMTRX_DisableAllCols();
-    LEDMTRX_ShiftLeft(Copy_Data);
-  }
-}
-
@@ -0,0 +1,47 @@
+/**
+ ********************************************************************************************
+ * @file STP_config.h
+ * @brief This file contains the configuration options of the serial to parallel (74HC595) driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __STP_CONFIG_H__
+#define __STP_CONFIG_H__
+
+/**
+ * @brief The number of daisy chained shift registers (8 outputs each).
+ */
+#define STP_NUM_REGISTERS           8
+
+/**
+ * @brief The way the bits are shifted into the chain.
+ *
+ * Available options:
+ * - STP_BACKEND_BITBANG: Serial data and shift clock driven through the GPIO set/reset register, two stores per bit
+ *   when both pins share a port.
+ * - STP_BACKEND_SPI: Serial data on MOSI and shift clock on SCK, the whole chain is one SPI burst. The application
+ *   initializes the peripheral (8-bit frames, MSB first, CPOL = 0, CPHA = 0) and its pins.
+ */
+#define STP_BACKEND                 STP_BACKEND_SPI
+
+/**
+ * @brief The SPI peripheral of the chain (SPI1, SPI2 or SPI3), used with STP_BACKEND_SPI.
+ */
+#define STP_SPI_PERIPHERAL          SPI1
+
+/**
+ * @brief The serial data (DS) and shift clock (SHCP) pins, used with STP_BACKEND_BITBANG.
+ */
+#define STP_SERIAL_DATA_PIN         GPIO_PORTA, 0
+#define STP_SHIFT_CLOCK_PIN         GPIO_PORTA, 1
+
+/**
+ * @brief The store clock (STCP, latch) pin, used with both back ends.
+ */
+#define STP_STORE_CLOCK_PIN         GPIO_PORTA, 2
+
+#endif /**< __STP_CONFIG_H__ */
@@ -0,0 +1,87 @@
+/**
+ ********************************************************************************************
+ * @file STP_interface.h
+ * @brief This file contains the interface of the serial to parallel (74HC595) driver.
+ *
+ * The driver handles a daisy chain of STP_NUM_REGISTERS shift registers. The outputs are changed in a shadow
+ * copy of the chain and sent together by STP_Commit(), either bit-banged on GPIO or in one hardware SPI burst,
+ * then latched to the outputs with a single pulse.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __STP_INTERFACE_H__
+#define __STP_INTERFACE_H__
+
+/**
+ * @addtogroup STP_Functions
+ * @{
+ */
+
+/**
+ * @brief Initializes the shift register chain.
+ *
+ * Configures the pins of the selected back end, clears the shadow copy and sends it, so all the outputs start low.
+ *
+ * @retval None
+ */
+void STP_Init(void);
+
+/**
+ * @brief Sets one output in the shadow copy.
+ *
+ * Output n is pin Qn%8 of register n/8, register 0 being the one wired to the microcontroller.
+ * Nothing is sent until STP_Commit().
+ *
+ * @param[in] Copy_Output The output number, 0 to (8 x STP_NUM_REGISTERS - 1).
+ * @param[in] Copy_Value STP_LOW or STP_HIGH.
+ * @retval None
+ */
+void STP_SetOutput(u16 Copy_Output, u8 Copy_Value);
+
+/**
+ * @brief Gets one output from the shadow copy.
+ *
+ * @param[in] Copy_Output The output number.
+ * @return The output value in the shadow copy, STP_LOW outside the chain.
+ */
+u8 STP_GetOutput(u16 Copy_Output);
+
+/**
+ * @brief Sets the 8 outputs of one register in the shadow copy, bit n driving Qn.
+ *
+ * @param[in] Copy_Register The register number in the chain (0 is wired to the microcontroller).
+ * @param[in] Copy_Value The register value.
+ * @retval None
+ */
+void STP_WriteRegister(u8 Copy_Register, u8 Copy_Value);
+
+/**
+ * @brief Sets every register in the shadow copy.
+ *
+ * @param[in] Copy_Values Pointer to STP_NUM_REGISTERS values, register 0 first.
+ * @retval None
+ */
+void STP_WriteAll(const u8 *Copy_Values);
+
+/**
+ * @brief Sends the shadow copy to the chain and latches it to the outputs.
+ *
+ * Nothing is sent when the shadow copy did not change since the last commit.
+ *
+ * @retval None
+ */
+void STP_Commit(void);
+
+/** @} STP_Functions */
+
+/**
+ * @brief Output values.
+ */
+#define STP_LOW                 0
+#define STP_HIGH                1
+
+#endif /**< __STP_INTERFACE_H__ */
@@ -0,0 +1,52 @@
+/**
+ ********************************************************************************************
+ * @file STP_private.h
+ * @brief This file contains the private definitions of the serial to parallel (74HC595) driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __STP_PRIVATE_H__
+#define __STP_PRIVATE_H__
+
+/**
+ * @brief Options of STP_BACKEND.
+ */
+#define STP_BACKEND_BITBANG         0
+#define STP_BACKEND_SPI             1
+
+/**
+ * @brief The number of outputs of the chain.
+ */
+#define STP_NUM_OUTPUTS             ((u16)STP_NUM_REGISTERS * 8)
+
+/**
+ * @brief Position of a register in the shadow copy.
+ *
+ * The shadow copy is kept in sending order (the farthest register first) so it is streamed as it is.
+ */
+#define STP_SHADOW_INDEX(REGISTER)  (STP_NUM_REGISTERS - 1 - (REGISTER))
+
+/**
+ * @brief A GPIO port and pin pair.
+ */
+typedef struct
+{
+    u8 Port;
+    u8 Pin;
+} STP_Pin_t;
+
+/**
+ * @brief Shifts the shadow copy into the chain with the selected back end.
+ */
+static void STP_ShiftOut(void);
+
+/**
+ * @brief Pulses the store clock, copying the shift registers to the outputs.
+ */
+static void STP_Latch(void);
+
+#endif /**< __STP_PRIVATE_H__ */
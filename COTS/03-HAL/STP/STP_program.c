@@ -0,0 +1,188 @@
+/**
+ ********************************************************************************************
+ * @file STP_program.c
+ * @brief This file contains the implementation of the serial to parallel (74HC595) driver.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "GPIO_interface.h"
+#include "SPI_interface.h"
+/**< HAL */
+#include "STP_interface.h"
+#include "STP_config.h"
+#include "STP_private.h"
+
+/**< Outputs of the chain in sending order, see STP_SHADOW_INDEX() */
+static u8 STP_Shadow[STP_NUM_REGISTERS];
+
+/**< Set when the shadow copy differs from the chain */
+static u8 STP_Dirty = 0;
+
+/**< Store clock pin and its set/reset register */
+static const STP_Pin_t STP_StorePin = {STP_STORE_CLOCK_PIN};
+static volatile u32 *STP_StoreBsrr;
+
+#if STP_BACKEND == STP_BACKEND_BITBANG
+/**< Serial data and shift clock pins and their set/reset registers */
+static const STP_Pin_t STP_DataPin = {STP_SERIAL_DATA_PIN};
+static const STP_Pin_t STP_ClockPin = {STP_SHIFT_CLOCK_PIN};
+static volatile u32 *STP_DataBsrr;
+static volatile u32 *STP_ClockBsrr;
+#elif STP_BACKEND == STP_BACKEND_SPI
+/**< SPI peripheral of the chain */
+static SPI_t STP_Spi;
+#else
+    #error "Wrong choice of shift register back end"
+#endif
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void STP_Init(void)
+{
+    /**< The latch idles low, the outputs follow on its rising edge */
+    GPIO_SetPinMode(STP_StorePin.Port, STP_StorePin.Pin, GPIO_OUTPUT_PP_50MHZ);
+    GPIO_SetPinValue(STP_StorePin.Port, STP_StorePin.Pin, GPIO_LOW);
+    STP_StoreBsrr = GPIO_GetSetResetRegister(STP_StorePin.Port);
+
+#if STP_BACKEND == STP_BACKEND_BITBANG
+    GPIO_SetPinMode(STP_DataPin.Port, STP_DataPin.Pin, GPIO_OUTPUT_PP_50MHZ);
+    GPIO_SetPinMode(STP_ClockPin.Port, STP_ClockPin.Pin, GPIO_OUTPUT_PP_50MHZ);
+    GPIO_SetPinValue(STP_ClockPin.Port, STP_ClockPin.Pin, GPIO_LOW);
+    STP_DataBsrr = GPIO_GetSetResetRegister(STP_DataPin.Port);
+    STP_ClockBsrr = GPIO_GetSetResetRegister(STP_ClockPin.Port);
+#elif STP_BACKEND == STP_BACKEND_SPI
+    STP_Spi = SPI_SelectSpiPeripheral(STP_SPI_PERIPHERAL);
+#endif
+
+    for (u8 Local_Iterator = 0; Local_Iterator < STP_NUM_REGISTERS; Local_Iterator++)
+    {
+        STP_Shadow[Local_Iterator] = 0;
+    }
+
+    /**< The outputs power up undefined, force them low */
+    STP_Dirty = 1;
+    STP_Commit();
+}
+
+void STP_SetOutput(u16 Copy_Output, u8 Copy_Value)
+{
+    u8 *Local_Register;
+
+    if (Copy_Output >= STP_NUM_OUTPUTS)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    Local_Register = &STP_Shadow[STP_SHADOW_INDEX(Copy_Output >> 3)];
+    if (Copy_Value == STP_LOW)
+    {
+        CLR_BIT(*Local_Register, (Copy_Output & 7));
+    }
+    else
+    {
+        SET_BIT(*Local_Register, (Copy_Output & 7));
+    }
+    STP_Dirty = 1;
+}
+
+u8 STP_GetOutput(u16 Copy_Output)
+{
+    if (Copy_Output >= STP_NUM_OUTPUTS)
+    {
+        return STP_LOW;
+    }
+
+    return GET_BIT(STP_Shadow[STP_SHADOW_INDEX(Copy_Output >> 3)], (Copy_Output & 7));
+}
+
+void STP_WriteRegister(u8 Copy_Register, u8 Copy_Value)
+{
+    if (Copy_Register >= STP_NUM_REGISTERS)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    STP_Shadow[STP_SHADOW_INDEX(Copy_Register)] = Copy_Value;
+    STP_Dirty = 1;
+}
+
+void STP_WriteAll(const u8 *Copy_Values)
+{
+    if (Copy_Values == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    for (u8 Local_Iterator = 0; Local_Iterator < STP_NUM_REGISTERS; Local_Iterator++)
+    {
+        STP_Shadow[STP_SHADOW_INDEX(Local_Iterator)] = Copy_Values[Local_Iterator];
+    }
+    STP_Dirty = 1;
+}
+
+void STP_Commit(void)
+{
+    if (!STP_Dirty)
+    {
+        return;
+    }
+
+    STP_Dirty = 0;
+    STP_ShiftOut();
+    STP_Latch();
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void STP_ShiftOut(void)
+{
+#if STP_BACKEND == STP_BACKEND_BITBANG
+    u32 Local_DataMask = (u32)1 << STP_DataPin.Pin;
+    u32 Local_ClockMask = (u32)1 << STP_ClockPin.Pin;
+    u8 Local_Byte;
+
+    for (u8 Local_Iterator = 0; Local_Iterator < STP_NUM_REGISTERS; Local_Iterator++)
+    {
+        Local_Byte = STP_Shadow[Local_Iterator];
+
+        /**< MSB first, so bit 7 ends in Q7 */
+        for (u8 Local_BitIterator = 0; Local_BitIterator < 8; Local_BitIterator++)
+        {
+            if (STP_DataBsrr == STP_ClockBsrr)
+            {
+                /**< Same port: the data bit and the clock falling edge in one store, the rising edge in a second */
+                *STP_DataBsrr = ((Local_Byte & 0x80) ? Local_DataMask : (Local_DataMask << 16)) | (Local_ClockMask << 16);
+            }
+            else
+            {
+                *STP_ClockBsrr = Local_ClockMask << 16;
+                *STP_DataBsrr = (Local_Byte & 0x80) ? Local_DataMask : (Local_DataMask << 16);
+            }
+            *STP_ClockBsrr = Local_ClockMask;
+            Local_Byte <<= 1;
+        }
+    }
+
+    *STP_ClockBsrr = Local_ClockMask << 16;
+#elif STP_BACKEND == STP_BACKEND_SPI
+    /**< The shadow copy is already in sending order, one burst for the whole chain */
+    SPI_voidTransmit(STP_Spi, STP_Shadow, STP_NUM_REGISTERS);
+#endif
+}
+
+static void STP_Latch(void)
+{
+    u32 Local_StoreMask = (u32)1 << STP_StorePin.Pin;
+
+    *STP_StoreBsrr = Local_StoreMask;
+    *STP_StoreBsrr = Local_StoreMask << 16;
+}
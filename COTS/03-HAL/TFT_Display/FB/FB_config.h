@@ -0,0 +1,22 @@
+/**
+ ********************************************************************************************
+ * @file FB_config.h
+ * @brief This file contains the configuration options for the indexed color frame buffer module.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __FB_CONFIG_H__
+#define __FB_CONFIG_H__
+
+/**
+ * @brief Number of pixels in the stack buffer used to expand the indexes to RGB565 during a flush.
+ *
+ * Rows longer than this are sent in several bursts inside the same address window.
+ */
+#define FB_FLUSH_BUFFER_PIXELS      64
+
+#endif /**< __FB_CONFIG_H__ */
@@ -0,0 +1,182 @@
+/**
+ ********************************************************************************************
+ * @file FB_interface.h
+ * @brief This file contains the interface of the indexed color frame buffer module.
+ *
+ * A 16-bit frame buffer does not fit in the SRAM even for the 128x160 ST7735S, but an 8-bit
+ * (20 KB) or 4-bit (10 KB) indexed one does. Drawing happens in the buffer, then FB_Flush()
+ * sends the changed rows to the panel, expanding the indexes to RGB565 through the palette
+ * while it streams, so the screen never shows a half drawn frame.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __FB_INTERFACE_H__
+#define __FB_INTERFACE_H__
+
+/**
+ * @note Include TFT_Device_interface.h before this file.
+ */
+
+/**
+ * @addtogroup FB_Types
+ * @{
+ */
+
+/**
+ * @brief Pixel formats of a frame buffer.
+ */
+typedef enum
+{
+    FB_FORMAT_INDEXED8 = 0,     /**< One byte per pixel, 256 colors palette */
+    FB_FORMAT_INDEXED4          /**< Two pixels per byte (left pixel in the high nibble), 16 colors palette */
+} FB_Format_t;
+
+/**
+ * @brief Size in bytes of the pixel storage of a frame buffer.
+ */
+#define FB_BUFFER_SIZE(WIDTH, HEIGHT, FORMAT)   (((FORMAT) == FB_FORMAT_INDEXED4) ? ((((u32)(WIDTH) + 1) / 2) * (HEIGHT)) : ((u32)(WIDTH) * (HEIGHT)))
+
+/**
+ * @brief Size in bytes of the dirty rows storage of a frame buffer (one bit per row).
+ */
+#define FB_DIRTY_SIZE(HEIGHT)                   (((u32)(HEIGHT) + 7) / 8)
+
+/**
+ * @brief Color key value of FB_DrawBitmap() meaning that all the pixels are opaque.
+ */
+#define FB_NO_COLOR_KEY                         0xFFFF
+
+/**
+ * @brief Indexed color frame buffer.
+ *
+ * The application allocates the structure and the storage (see FB_BUFFER_SIZE() and FB_DIRTY_SIZE()),
+ * FB_Init() fills the structure.
+ */
+typedef struct
+{
+    const TFT_Device_t *Device;     /**< Display the buffer is flushed to */
+    u8 *Pixels;                     /**< Pixel indexes, row by row */
+    u8 *DirtyRows;                  /**< One bit per row changed since the last flush, NULL to always flush everything */
+    const u16 *Palette;             /**< RGB565 color of each index */
+    u16 Width;                      /**< Width in pixels */
+    u16 Height;                     /**< Height in pixels */
+    u16 Stride;                     /**< Bytes per row */
+    FB_Format_t Format;             /**< Pixel format */
+} FB_t;
+
+/** @} FB_Types */
+
+/**
+ * @addtogroup FB_Functions
+ * @{
+ */
+
+/**
+ * @brief Initializes a frame buffer covering the whole display in its current orientation.
+ *
+ * All the rows are marked dirty, the buffer content is not cleared.
+ *
+ * @param[out] Copy_Buffer Pointer to the frame buffer.
+ * @param[in] Copy_Device Pointer to the display the buffer is flushed to.
+ * @param[in] Copy_Format The pixel format.
+ * @param[in] Copy_Pixels Pointer to FB_BUFFER_SIZE() bytes for the pixels.
+ * @param[in] Copy_DirtyRows Pointer to FB_DIRTY_SIZE() bytes for the dirty rows, or NULL to disable the tracking.
+ * @param[in] Copy_Palette Pointer to the palette: 256 (8-bit) or 16 (4-bit) RGB565 colors.
+ * @retval None
+ */
+void FB_Init(FB_t *Copy_Buffer, const TFT_Device_t *Copy_Device, FB_Format_t Copy_Format, u8 *Copy_Pixels, u8 *Copy_DirtyRows, const u16 *Copy_Palette);
+
+/**
+ * @brief Changes the palette, all the rows are marked dirty.
+ *
+ * @param[in,out] Copy_Buffer Pointer to the frame buffer.
+ * @param[in] Copy_Palette Pointer to the new palette.
+ * @retval None
+ */
+void FB_SetPalette(FB_t *Copy_Buffer, const u16 *Copy_Palette);
+
+/**
+ * @brief Fills the whole buffer with one index.
+ *
+ * @param[in,out] Copy_Buffer Pointer to the frame buffer.
+ * @param[in] Copy_Index The palette index.
+ * @retval None
+ */
+void FB_Clear(FB_t *Copy_Buffer, u8 Copy_Index);
+
+/**
+ * @brief Sets one pixel, ignored outside the buffer.
+ *
+ * @param[in,out] Copy_Buffer Pointer to the frame buffer.
+ * @param[in] Copy_XPosition The X-coordinate of the pixel.
+ * @param[in] Copy_YPosition The Y-coordinate of the pixel.
+ * @param[in] Copy_Index The palette index.
+ * @retval None
+ */
+void FB_SetPixel(FB_t *Copy_Buffer, s16 Copy_XPosition, s16 Copy_YPosition, u8 Copy_Index);
+
+/**
+ * @brief Gets the index of one pixel.
+ *
+ * @param[in] Copy_Buffer Pointer to the frame buffer.
+ * @param[in] Copy_XPosition The X-coordinate of the pixel.
+ * @param[in] Copy_YPosition The Y-coordinate of the pixel.
+ * @return The palette index, 0 outside the buffer.
+ */
+u8 FB_GetPixel(const FB_t *Copy_Buffer, u16 Copy_XPosition, u16 Copy_YPosition);
+
+/**
+ * @brief Fills a rectangle, clipped to the buffer.
+ *
+ * @param[in,out] Copy_Buffer Pointer to the frame buffer.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The rectangle width in pixels.
+ * @param[in] Copy_Height The rectangle height in pixels.
+ * @param[in] Copy_Index The palette index.
+ * @retval None
+ */
+void FB_FillRect(FB_t *Copy_Buffer, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u8 Copy_Index);
+
+/**
+ * @brief Copies an 8-bit indexed bitmap into the buffer, clipped to the buffer.
+ *
+ * @param[in,out] Copy_Buffer Pointer to the frame buffer.
+ * @param[in] Copy_XPosition The X-coordinate of the bitmap top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the bitmap top-left corner.
+ * @param[in] Copy_Width The bitmap width in pixels.
+ * @param[in] Copy_Height The bitmap height in pixels.
+ * @param[in] Copy_Bitmap Pointer to the bitmap indexes, one byte per pixel, row by row.
+ * @param[in] Copy_ColorKey The index left transparent, or FB_NO_COLOR_KEY.
+ * @retval None
+ */
+void FB_DrawBitmap(FB_t *Copy_Buffer, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u8 *Copy_Bitmap, u16 Copy_ColorKey);
+
+/**
+ * @brief Marks rows as changed, for code writing to the pixels directly.
+ *
+ * @param[in,out] Copy_Buffer Pointer to the frame buffer.
+ * @param[in] Copy_FirstRow The first changed row.
+ * @param[in] Copy_LastRow The last changed row (inclusive).
+ * @retval None
+ */
+void FB_MarkDirty(FB_t *Copy_Buffer, u16 Copy_FirstRow, u16 Copy_LastRow);
+
+/**
+ * @brief Sends the changed rows to the display.
+ *
+ * Each run of consecutive dirty rows is one address window, the pixels are expanded through the palette
+ * while they are streamed. Without dirty rows tracking the whole buffer is sent.
+ *
+ * @param[in,out] Copy_Buffer Pointer to the frame buffer.
+ * @retval None
+ */
+void FB_Flush(FB_t *Copy_Buffer);
+
+/** @} FB_Functions */
+
+#endif /**< __FB_INTERFACE_H__ */
@@ -0,0 +1,39 @@
+/**
+ ********************************************************************************************
+ * @file FB_private.h
+ * @brief This file contains the private definitions of the indexed color frame buffer module.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __FB_PRIVATE_H__
+#define __FB_PRIVATE_H__
+
+/**
+ * @brief Checks the dirty bit of a row.
+ */
+#define FB_IS_ROW_DIRTY(BUFFER, ROW)    GET_BIT((BUFFER)->DirtyRows[(ROW) >> 3], ((ROW) & 7))
+
+/**
+ * @brief Writes one pixel, the coordinates must be inside the buffer.
+ *
+ * @param Copy_Buffer Pointer to the frame buffer.
+ * @param Copy_XPosition The X-coordinate of the pixel.
+ * @param Copy_YPosition The Y-coordinate of the pixel.
+ * @param Copy_Index The palette index.
+ */
+static void FB_WritePixel(FB_t *Copy_Buffer, u16 Copy_XPosition, u16 Copy_YPosition, u8 Copy_Index);
+
+/**
+ * @brief Sends a run of rows to the display in one address window.
+ *
+ * @param Copy_Buffer Pointer to the frame buffer.
+ * @param Copy_FirstRow The first row.
+ * @param Copy_LastRow The last row (inclusive).
+ */
+static void FB_FlushRows(const FB_t *Copy_Buffer, u16 Copy_FirstRow, u16 Copy_LastRow);
+
+#endif /**< __FB_PRIVATE_H__ */
@@ -0,0 +1,350 @@
+/**
+ ********************************************************************************************
+ * @file FB_program.c
+ * @brief This file contains the implementation of the indexed color frame buffer module.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< HAL */
+#include "TFT_Device_interface.h"
+#include "FB_interface.h"
+#include "FB_private.h"
+#include "FB_config.h"
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void FB_Init(FB_t *Copy_Buffer, const TFT_Device_t *Copy_Device, FB_Format_t Copy_Format, u8 *Copy_Pixels, u8 *Copy_DirtyRows, const u16 *Copy_Palette)
+{
+    if ((Copy_Buffer == NULL) || (Copy_Device == NULL) || (Copy_Pixels == NULL))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    Copy_Buffer->Device = Copy_Device;
+    Copy_Buffer->Pixels = Copy_Pixels;
+    Copy_Buffer->DirtyRows = Copy_DirtyRows;
+    Copy_Buffer->Palette = Copy_Palette;
+    Copy_Buffer->Width = TFT_GetWidth(Copy_Device);
+    Copy_Buffer->Height = TFT_GetHeight(Copy_Device);
+    Copy_Buffer->Format = Copy_Format;
+    Copy_Buffer->Stride = (Copy_Format == FB_FORMAT_INDEXED4) ? ((Copy_Buffer->Width + 1) / 2) : Copy_Buffer->Width;
+
+    /**< The panel content is unknown, the first flush sends everything */
+    FB_MarkDirty(Copy_Buffer, 0, Copy_Buffer->Height - 1);
+}
+
+void FB_SetPalette(FB_t *Copy_Buffer, const u16 *Copy_Palette)
+{
+    Copy_Buffer->Palette = Copy_Palette;
+
+    /**< Every pixel may change color */
+    FB_MarkDirty(Copy_Buffer, 0, Copy_Buffer->Height - 1);
+}
+
+void FB_Clear(FB_t *Copy_Buffer, u8 Copy_Index)
+{
+    FB_FillRect(Copy_Buffer, 0, 0, Copy_Buffer->Width, Copy_Buffer->Height, Copy_Index);
+}
+
+void FB_SetPixel(FB_t *Copy_Buffer, s16 Copy_XPosition, s16 Copy_YPosition, u8 Copy_Index)
+{
+    if ((Copy_XPosition < 0) || (Copy_YPosition < 0) || (Copy_XPosition >= (s32)Copy_Buffer->Width) || (Copy_YPosition >= (s32)Copy_Buffer->Height))
+    {
+        return;
+    }
+
+    FB_WritePixel(Copy_Buffer, (u16)Copy_XPosition, (u16)Copy_YPosition, Copy_Index);
+    FB_MarkDirty(Copy_Buffer, (u16)Copy_YPosition, (u16)Copy_YPosition);
+}
+
+u8 FB_GetPixel(const FB_t *Copy_Buffer, u16 Copy_XPosition, u16 Copy_YPosition)
+{
+    u8 Local_Byte;
+
+    if ((Copy_XPosition >= Copy_Buffer->Width) || (Copy_YPosition >= Copy_Buffer->Height))
+    {
+        return 0;
+    }
+
+    if (Copy_Buffer->Format == FB_FORMAT_INDEXED4)
+    {
+        Local_Byte = Copy_Buffer->Pixels[(u32)Copy_YPosition * Copy_Buffer->Stride + (Copy_XPosition >> 1)];
+        return (Copy_XPosition & 1) ? (Local_Byte & 0x0F) : (Local_Byte >> 4);
+    }
+
+    return Copy_Buffer->Pixels[(u32)Copy_YPosition * Copy_Buffer->Stride + Copy_XPosition];
+}
+
+void FB_FillRect(FB_t *Copy_Buffer, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u8 Copy_Index)
+{
+    s32 Local_X1 = Copy_XPosition;
+    s32 Local_Y1 = Copy_YPosition;
+    s32 Local_X2 = (s32)Copy_XPosition + Copy_Width - 1;
+    s32 Local_Y2 = (s32)Copy_YPosition + Copy_Height - 1;
+    s32 Local_X;
+    s32 Local_Y;
+    u8 *Local_Row;
+    u8 Local_Packed;
+
+    /**< Clip to the buffer */
+    if (Local_X1 < 0)
+    {
+        Local_X1 = 0;
+    }
+    if (Local_Y1 < 0)
+    {
+        Local_Y1 = 0;
+    }
+    if (Local_X2 >= (s32)Copy_Buffer->Width)
+    {
+        Local_X2 = Copy_Buffer->Width - 1;
+    }
+    if (Local_Y2 >= (s32)Copy_Buffer->Height)
+    {
+        Local_Y2 = Copy_Buffer->Height - 1;
+    }
+    if ((Copy_Width == 0) || (Copy_Height == 0) || (Local_X1 > Local_X2) || (Local_Y1 > Local_Y2))
+    {
+        return;
+    }
+
+    for (Local_Y = Local_Y1; Local_Y <= Local_Y2; Local_Y++)
+    {
+        Local_Row = &Copy_Buffer->Pixels[(u32)Local_Y * Copy_Buffer->Stride];
+
+        if (Copy_Buffer->Format == FB_FORMAT_INDEXED8)
+        {
+            for (Local_X = Local_X1; Local_X <= Local_X2; Local_X++)
+            {
+                Local_Row[Local_X] = Copy_Index;
+            }
+        }
+        else
+        {
+            Local_X = Local_X1;
+
+            /**< A leading right nibble, then whole bytes, then a trailing left nibble */
+            if (Local_X & 1)
+            {
+                FB_WritePixel(Copy_Buffer, (u16)Local_X, (u16)Local_Y, Copy_Index);
+                Local_X++;
+            }
+            Local_Packed = (u8)((Copy_Index << 4) | (Copy_Index & 0x0F));
+            while ((Local_X + 1) <= Local_X2)
+            {
+                Local_Row[Local_X >> 1] = Local_Packed;
+                Local_X += 2;
+            }
+            if (Local_X == Local_X2)
+            {
+                FB_WritePixel(Copy_Buffer, (u16)Local_X, (u16)Local_Y, Copy_Index);
+            }
+        }
+    }
+
+    FB_MarkDirty(Copy_Buffer, (u16)Local_Y1, (u16)Local_Y2);
+}
+
+void FB_DrawBitmap(FB_t *Copy_Buffer, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u8 *Copy_Bitmap, u16 Copy_ColorKey)
+{
+    s32 Local_X1 = Copy_XPosition;
+    s32 Local_Y1 = Copy_YPosition;
+    s32 Local_X2 = (s32)Copy_XPosition + Copy_Width - 1;
+    s32 Local_Y2 = (s32)Copy_YPosition + Copy_Height - 1;
+    s32 Local_X;
+    s32 Local_Y;
+    const u8 *Local_Source;
+
+    if ((Copy_Bitmap == NULL) || (Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    /**< Clip to the buffer */
+    if (Local_X1 < 0)
+    {
+        Local_X1 = 0;
+    }
+    if (Local_Y1 < 0)
+    {
+        Local_Y1 = 0;
+    }
+    if (Local_X2 >= (s32)Copy_Buffer->Width)
+    {
+        Local_X2 = Copy_Buffer->Width - 1;
+    }
+    if (Local_Y2 >= (s32)Copy_Buffer->Height)
+    {
+        Local_Y2 = Copy_Buffer->Height - 1;
+    }
+    if ((Local_X1 > Local_X2) || (Local_Y1 > Local_Y2))
+    {
+        return;
+    }
+
+    for (Local_Y = Local_Y1; Local_Y <= Local_Y2; Local_Y++)
+    {
+        Local_Source = &Copy_Bitmap[(u32)(Local_Y - Copy_YPosition) * Copy_Width + (Local_X1 - Copy_XPosition)];
+
+        for (Local_X = Local_X1; Local_X <= Local_X2; Local_X++)
+        {
+            if (*Local_Source != Copy_ColorKey)
+            {
+                FB_WritePixel(Copy_Buffer, (u16)Local_X, (u16)Local_Y, *Local_Source);
+            }
+            Local_Source++;
+        }
+    }
+
+    FB_MarkDirty(Copy_Buffer, (u16)Local_Y1, (u16)Local_Y2);
+}
+
+void FB_MarkDirty(FB_t *Copy_Buffer, u16 Copy_FirstRow, u16 Copy_LastRow)
+{
+    u16 Local_Row;
+
+    if (Copy_Buffer->DirtyRows == NULL)
+    {
+        return;
+    }
+
+    if (Copy_LastRow >= Copy_Buffer->Height)
+    {
+        Copy_LastRow = Copy_Buffer->Height - 1;
+    }
+
+    for (Local_Row = Copy_FirstRow; Local_Row <= Copy_LastRow; Local_Row++)
+    {
+        SET_BIT(Copy_Buffer->DirtyRows[Local_Row >> 3], (Local_Row & 7));
+    }
+}
+
+void FB_Flush(FB_t *Copy_Buffer)
+{
+    u16 Local_Row = 0;
+    u16 Local_RunStart;
+
+    if ((Copy_Buffer->Device == NULL) || (Copy_Buffer->Palette == NULL))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    /**< Without tracking every row is dirty */
+    if (Copy_Buffer->DirtyRows == NULL)
+    {
+        FB_FlushRows(Copy_Buffer, 0, Copy_Buffer->Height - 1);
+        return;
+    }
+
+    while (Local_Row < Copy_Buffer->Height)
+    {
+        /**< Whole clean bytes are skipped eight rows at a time */
+        if (((Local_Row & 7) == 0) && (Copy_Buffer->DirtyRows[Local_Row >> 3] == 0))
+        {
+            Local_Row += 8;
+            continue;
+        }
+
+        if (!FB_IS_ROW_DIRTY(Copy_Buffer, Local_Row))
+        {
+            Local_Row++;
+            continue;
+        }
+
+        /**< Collect the run of dirty rows and clear their bits */
+        Local_RunStart = Local_Row;
+        while ((Local_Row < Copy_Buffer->Height) && FB_IS_ROW_DIRTY(Copy_Buffer, Local_Row))
+        {
+            CLR_BIT(Copy_Buffer->DirtyRows[Local_Row >> 3], (Local_Row & 7));
+            Local_Row++;
+        }
+
+        FB_FlushRows(Copy_Buffer, Local_RunStart, Local_Row - 1);
+    }
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void FB_WritePixel(FB_t *Copy_Buffer, u16 Copy_XPosition, u16 Copy_YPosition, u8 Copy_Index)
+{
+    u8 *Local_Byte;
+
+    if (Copy_Buffer->Format == FB_FORMAT_INDEXED4)
+    {
+        Local_Byte = &Copy_Buffer->Pixels[(u32)Copy_YPosition * Copy_Buffer->Stride + (Copy_XPosition >> 1)];
+        if (Copy_XPosition & 1)
+        {
+            *Local_Byte = (*Local_Byte & 0xF0) | (Copy_Index & 0x0F);
+        }
+        else
+        {
+            *Local_Byte = (*Local_Byte & 0x0F) | (u8)(Copy_Index << 4);
+        }
+    }
+    else
+    {
+        Copy_Buffer->Pixels[(u32)Copy_YPosition * Copy_Buffer->Stride + Copy_XPosition] = Copy_Index;
+    }
+}
+
+static void FB_FlushRows(const FB_t *Copy_Buffer, u16 Copy_FirstRow, u16 Copy_LastRow)
+{
+    const TFT_Device_t *Local_Device = Copy_Buffer->Device;
+    const u16 *Local_Palette = Copy_Buffer->Palette;
+    u16 Local_Line[FB_FLUSH_BUFFER_PIXELS];
+    const u8 *Local_Source;
+    u16 Local_Row;
+    u16 Local_Column;
+    u16 Local_Chunk;
+    u16 Local_Iterator;
+
+    /**< One window for the whole run, the rows follow each other in the panel memory */
+    Local_Device->Ops->SetWindow(Local_Device, 0, Copy_FirstRow, Copy_Buffer->Width - 1, Copy_LastRow);
+
+    for (Local_Row = Copy_FirstRow; Local_Row <= Copy_LastRow; Local_Row++)
+    {
+        Local_Source = &Copy_Buffer->Pixels[(u32)Local_Row * Copy_Buffer->Stride];
+
+        for (Local_Column = 0; Local_Column < Copy_Buffer->Width; Local_Column += Local_Chunk)
+        {
+            Local_Chunk = Copy_Buffer->Width - Local_Column;
+            if (Local_Chunk > FB_FLUSH_BUFFER_PIXELS)
+            {
+                Local_Chunk = FB_FLUSH_BUFFER_PIXELS;
+            }
+
+            /**< Expand the indexes through the palette */
+            if (Copy_Buffer->Format == FB_FORMAT_INDEXED8)
+            {
+                for (Local_Iterator = 0; Local_Iterator < Local_Chunk; Local_Iterator++)
+                {
+                    Local_Line[Local_Iterator] = Local_Palette[*Local_Source];
+                    Local_Source++;
+                }
+            }
+            else
+            {
+                /**< FB_FLUSH_BUFFER_PIXELS is even, so a chunk always starts on a byte boundary */
+                for (Local_Iterator = 0; (Local_Iterator + 1) < Local_Chunk; Local_Iterator += 2)
+                {
+                    Local_Line[Local_Iterator] = Local_Palette[*Local_Source >> 4];
+                    Local_Line[Local_Iterator + 1] = Local_Palette[*Local_Source & 0x0F];
+                    Local_Source++;
+                }
+                if (Local_Iterator < Local_Chunk)
+                {
+                    Local_Line[Local_Iterator] = Local_Palette[*Local_Source >> 4];
+                    Local_Source++;
+                }
+            }
+
+            Local_Device->Ops->PushPixels(Local_Device, Local_Line, Local_Chunk);
+        }
+    }
+}
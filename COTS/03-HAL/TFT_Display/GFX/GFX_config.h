@@ -0,0 +1,22 @@
+/**
+ ********************************************************************************************
+ * @file GFX_config.h
+ * @brief This file contains the configuration options for the TFT graphics module.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __GFX_CONFIG_H__
+#define __GFX_CONFIG_H__
+
+/**
+ * @brief Number of pixels in the stack buffer used to expand indexed pixels before sending them.
+ *
+ * Longer runs are sent in several windows of this size.
+ */
+#define GFX_SPAN_BUFFER_PIXELS      32
+
+#endif /**< __GFX_CONFIG_H__ */
@@ -0,0 +1,205 @@
+/**
+ ********************************************************************************************
+ * @file GFX_interface.h
+ * @brief This file contains the interface of the TFT graphics module.
+ *
+ * The graphics module draws on top of a TFT driver, it holds the rasterizers shared by all the panels. Everything it draws is split into runs of
+ * consecutive pixels on one row, and every run is sent as one address window followed by one burst,
+ * which is much cheaper than addressing each pixel.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __GFX_INTERFACE_H__
+#define __GFX_INTERFACE_H__
+
+/**
+ * @note Include TFT_Device_interface.h before this file.
+ */
+
+/**
+ * @addtogroup GFX_Types
+ * @{
+ */
+
+/**
+ * @brief Pixel formats of a sprite sheet.
+ */
+typedef enum
+{
+    GFX_FORMAT_RGB565 = 0,      /**< One u16 RGB565 color per pixel */
+    GFX_FORMAT_INDEXED8         /**< One u8 palette index per pixel */
+} GFX_Format_t;
+
+/**
+ * @brief Sprite sheet descriptor.
+ *
+ * A sheet is a bitmap stored row by row, usually in flash, that holds one or more sprites.
+ * Sprites are drawn by giving their rectangle inside the sheet.
+ */
+typedef struct
+{
+    const void *Pixels;         /**< Pixel data, u16 colors or u8 palette indexes depending on Format */
+    const u16 *Palette;         /**< RGB565 palette for GFX_FORMAT_INDEXED8 sheets, unused otherwise */
+    u16 Width;                  /**< Sheet width in pixels */
+    u16 Height;                 /**< Sheet height in pixels */
+    GFX_Format_t Format;        /**< Pixel format of the sheet */
+    u8 HasColorKey;             /**< Non zero if the pixels equal to ColorKey are transparent */
+    u16 ColorKey;               /**< Transparent color (RGB565 sheets) or palette index (indexed sheets) */
+} GFX_Sheet_t;
+
+/** @} GFX_Types */
+
+/**
+ * @addtogroup GFX_Functions
+ * @{
+ */
+
+/**
+ * @brief Draws a rectangle of a sprite sheet on the screen.
+ *
+ * The part of the sprite falling outside the screen is clipped, so the position may be negative or beyond
+ * the screen edges (e.g. sprites sliding in). When the sheet has a color key, each row is split into runs
+ * of opaque pixels and only those runs are sent, the screen behind the transparent pixels is left untouched.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_Sheet Pointer to the sprite sheet.
+ * @param[in] Copy_SourceX The X-coordinate of the sprite inside the sheet.
+ * @param[in] Copy_SourceY The Y-coordinate of the sprite inside the sheet.
+ * @param[in] Copy_Width The sprite width in pixels.
+ * @param[in] Copy_Height The sprite height in pixels.
+ * @param[in] Copy_XPosition The screen X-coordinate of the sprite top-left corner.
+ * @param[in] Copy_YPosition The screen Y-coordinate of the sprite top-left corner.
+ * @retval None
+ */
+void GFX_DrawSprite(const TFT_Device_t *Copy_Device, const GFX_Sheet_t *Copy_Sheet, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, s16 Copy_XPosition, s16 Copy_YPosition);
+
+/**
+ * @brief Fills a rectangle, clipped to the screen.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The rectangle width in pixels.
+ * @param[in] Copy_Height The rectangle height in pixels.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void GFX_FillRect(const TFT_Device_t *Copy_Device, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color);
+
+/**
+ * @brief Draws the outline of a rectangle, clipped to the screen.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The rectangle width in pixels.
+ * @param[in] Copy_Height The rectangle height in pixels.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void GFX_DrawRect(const TFT_Device_t *Copy_Device, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color);
+
+/**
+ * @brief Draws a line between two points.
+ *
+ * The line is sent as runs: horizontal runs for lines closer to horizontal, vertical runs otherwise.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_X1 The X-coordinate of the starting point.
+ * @param[in] Copy_Y1 The Y-coordinate of the starting point.
+ * @param[in] Copy_X2 The X-coordinate of the ending point.
+ * @param[in] Copy_Y2 The Y-coordinate of the ending point.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void GFX_DrawLine(const TFT_Device_t *Copy_Device, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, u16 Copy_Color);
+
+/**
+ * @brief Draws the outline of a circle.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_XCenter The X-coordinate of the center.
+ * @param[in] Copy_YCenter The Y-coordinate of the center.
+ * @param[in] Copy_Radius The radius in pixels.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void GFX_DrawCircle(const TFT_Device_t *Copy_Device, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Color);
+
+/**
+ * @brief Draws a filled circle.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_XCenter The X-coordinate of the center.
+ * @param[in] Copy_YCenter The Y-coordinate of the center.
+ * @param[in] Copy_Radius The radius in pixels.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void GFX_FillCircle(const TFT_Device_t *Copy_Device, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Color);
+
+/**
+ * @brief Draws the outline of a rectangle with rounded corners.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The rectangle width in pixels.
+ * @param[in] Copy_Height The rectangle height in pixels.
+ * @param[in] Copy_Radius The corner radius, limited to half of the smaller side.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void GFX_DrawRoundRect(const TFT_Device_t *Copy_Device, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Radius, u16 Copy_Color);
+
+/**
+ * @brief Draws a filled rectangle with rounded corners.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The rectangle width in pixels.
+ * @param[in] Copy_Height The rectangle height in pixels.
+ * @param[in] Copy_Radius The corner radius, limited to half of the smaller side.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void GFX_FillRoundRect(const TFT_Device_t *Copy_Device, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Radius, u16 Copy_Color);
+
+/**
+ * @brief Draws the outline of a triangle.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_X1 The X-coordinate of the first vertex.
+ * @param[in] Copy_Y1 The Y-coordinate of the first vertex.
+ * @param[in] Copy_X2 The X-coordinate of the second vertex.
+ * @param[in] Copy_Y2 The Y-coordinate of the second vertex.
+ * @param[in] Copy_X3 The X-coordinate of the third vertex.
+ * @param[in] Copy_Y3 The Y-coordinate of the third vertex.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void GFX_DrawTriangle(const TFT_Device_t *Copy_Device, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, s16 Copy_X3, s16 Copy_Y3, u16 Copy_Color);
+
+/**
+ * @brief Draws a filled triangle, one horizontal run per row.
+ *
+ * @param[in] Copy_Device Pointer to the display to draw on.
+ * @param[in] Copy_X1 The X-coordinate of the first vertex.
+ * @param[in] Copy_Y1 The Y-coordinate of the first vertex.
+ * @param[in] Copy_X2 The X-coordinate of the second vertex.
+ * @param[in] Copy_Y2 The Y-coordinate of the second vertex.
+ * @param[in] Copy_X3 The X-coordinate of the third vertex.
+ * @param[in] Copy_Y3 The Y-coordinate of the third vertex.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void GFX_FillTriangle(const TFT_Device_t *Copy_Device, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, s16 Copy_X3, s16 Copy_Y3, u16 Copy_Color);
+
+/** @} GFX_Functions */
+
+#endif /**< __GFX_INTERFACE_H__ */
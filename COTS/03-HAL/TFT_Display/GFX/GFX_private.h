@@ -0,0 +1,68 @@
+/**
+ ********************************************************************************************
+ * @file GFX_private.h
+ * @brief This file contains the private definitions of the TFT graphics module.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __GFX_PRIVATE_H__
+#define __GFX_PRIVATE_H__
+
+/**
+ * @brief Checks if a sheet pixel is transparent.
+ *
+ * @param Copy_Sheet Pointer to the sprite sheet.
+ * @param Copy_Offset The pixel offset in the sheet (row * width + column).
+ * @return Non zero if the pixel matches the sheet color key.
+ */
+static u8 GFX_IsTransparent(const GFX_Sheet_t *Copy_Sheet, u32 Copy_Offset);
+
+/**
+ * @brief Draws a run of consecutive sheet pixels on one screen row.
+ *
+ * @param Copy_Device Pointer to the display to draw on.
+ * @param Copy_Sheet Pointer to the sprite sheet.
+ * @param Copy_Offset The offset of the first pixel of the run in the sheet.
+ * @param Copy_XPosition The screen X-coordinate of the run.
+ * @param Copy_YPosition The screen Y-coordinate of the run.
+ * @param Copy_Length The number of pixels in the run.
+ */
+static void GFX_DrawSheetSpan(const TFT_Device_t *Copy_Device, const GFX_Sheet_t *Copy_Sheet, u32 Copy_Offset, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length);
+
+/**
+ * @brief Fills the rectangle between two corners (inclusive), clipped to the screen.
+ *
+ * This is the only path to the panel for the shape primitives: each call is one window and one burst.
+ *
+ * @param Copy_Device Pointer to the display to draw on.
+ * @param Copy_X1 The X-coordinate of one corner.
+ * @param Copy_Y1 The Y-coordinate of one corner.
+ * @param Copy_X2 The X-coordinate of the opposite corner.
+ * @param Copy_Y2 The Y-coordinate of the opposite corner.
+ * @param Copy_Color The color in 16-bit RGB565 format.
+ */
+static void GFX_FillArea(const TFT_Device_t *Copy_Device, s32 Copy_X1, s32 Copy_Y1, s32 Copy_X2, s32 Copy_Y2, u16 Copy_Color);
+
+/**
+ * @brief Draws a circle stretched into a rounded rectangle.
+ *
+ * The four quarter circles are centered on the corners of the inner rectangle given by the top-left
+ * center and the stretch. Each row of the arcs is found incrementally, without square roots, and sent
+ * as one or two runs.
+ *
+ * @param Copy_Device Pointer to the display to draw on.
+ * @param Copy_XCenter The X-coordinate of the top-left quarter circle center.
+ * @param Copy_YCenter The Y-coordinate of the top-left quarter circle center.
+ * @param Copy_Radius The radius in pixels.
+ * @param Copy_StretchX The horizontal distance between the left and right centers.
+ * @param Copy_StretchY The vertical distance between the top and bottom centers.
+ * @param Copy_Color The color in 16-bit RGB565 format.
+ * @param Copy_Filled Non zero to fill the shape, zero to draw its outline.
+ */
+static void GFX_DrawRoundedShape(const TFT_Device_t *Copy_Device, s32 Copy_XCenter, s32 Copy_YCenter, s32 Copy_Radius, s32 Copy_StretchX, s32 Copy_StretchY, u16 Copy_Color, u8 Copy_Filled);
+
+#endif /**< __GFX_PRIVATE_H__ */
@@ -0,0 +1,497 @@
+/**
+ ********************************************************************************************
+ * @file GFX_program.c
+ * @brief This file contains the implementation of the TFT graphics module.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< HAL */
+#include "TFT_Device_interface.h"
+#include "GFX_interface.h"
+#include "GFX_private.h"
+#include "GFX_config.h"
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void GFX_DrawSprite(const TFT_Device_t *Copy_Device, const GFX_Sheet_t *Copy_Sheet, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, s16 Copy_XPosition, s16 Copy_YPosition)
+{
+    s32 Local_XPosition = Copy_XPosition;
+    s32 Local_YPosition = Copy_YPosition;
+    s32 Local_ScreenWidth;
+    s32 Local_ScreenHeight;
+    u32 Local_RowOffset;
+    u16 Local_Row;
+    u16 Local_Column;
+    u16 Local_SpanStart;
+
+    if ((Copy_Device == NULL) || (Copy_Sheet == NULL) || (Copy_Sheet->Pixels == NULL) ||
+        ((Copy_Sheet->Format == GFX_FORMAT_INDEXED8) && (Copy_Sheet->Palette == NULL)))
+    {
+        return;
+    }
+
+    Local_ScreenWidth = TFT_GetWidth(Copy_Device);
+    Local_ScreenHeight = TFT_GetHeight(Copy_Device);
+
+    /**< Keep the source rectangle inside the sheet */
+    if ((Copy_SourceX >= Copy_Sheet->Width) || (Copy_SourceY >= Copy_Sheet->Height))
+    {
+        return;
+    }
+    if (Copy_Width > (Copy_Sheet->Width - Copy_SourceX))
+    {
+        Copy_Width = Copy_Sheet->Width - Copy_SourceX;
+    }
+    if (Copy_Height > (Copy_Sheet->Height - Copy_SourceY))
+    {
+        Copy_Height = Copy_Sheet->Height - Copy_SourceY;
+    }
+
+    /**< Clip against the left and top screen edges by moving the source origin */
+    if (Local_XPosition < 0)
+    {
+        if ((-Local_XPosition) >= Copy_Width)
+        {
+            return;
+        }
+        Copy_SourceX += (u16)(-Local_XPosition);
+        Copy_Width -= (u16)(-Local_XPosition);
+        Local_XPosition = 0;
+    }
+    if (Local_YPosition < 0)
+    {
+        if ((-Local_YPosition) >= Copy_Height)
+        {
+            return;
+        }
+        Copy_SourceY += (u16)(-Local_YPosition);
+        Copy_Height -= (u16)(-Local_YPosition);
+        Local_YPosition = 0;
+    }
+
+    /**< Clip against the right and bottom screen edges */
+    if ((Local_XPosition >= Local_ScreenWidth) || (Local_YPosition >= Local_ScreenHeight) || (Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+    if ((Local_XPosition + Copy_Width) > Local_ScreenWidth)
+    {
+        Copy_Width = (u16)(Local_ScreenWidth - Local_XPosition);
+    }
+    if ((Local_YPosition + Copy_Height) > Local_ScreenHeight)
+    {
+        Copy_Height = (u16)(Local_ScreenHeight - Local_YPosition);
+    }
+
+    /**< Opaque RGB565 sprite covering whole sheet rows: the source is contiguous, one window for all of it */
+    if ((Copy_Sheet->Format == GFX_FORMAT_RGB565) && (!Copy_Sheet->HasColorKey) && (Copy_Width == Copy_Sheet->Width))
+    {
+        TFT_DrawBitmap(Copy_Device, (u16)Local_XPosition, (u16)Local_YPosition, Copy_Width, Copy_Height,
+                       &((const u16 *)Copy_Sheet->Pixels)[(u32)Copy_SourceY * Copy_Sheet->Width]);
+        return;
+    }
+
+    for (Local_Row = 0; Local_Row < Copy_Height; Local_Row++)
+    {
+        Local_RowOffset = (u32)(Copy_SourceY + Local_Row) * Copy_Sheet->Width + Copy_SourceX;
+        Local_Column = 0;
+
+        while (Local_Column < Copy_Width)
+        {
+            /**< Skip the transparent run */
+            if (Copy_Sheet->HasColorKey)
+            {
+                while ((Local_Column < Copy_Width) && GFX_IsTransparent(Copy_Sheet, Local_RowOffset + Local_Column))
+                {
+                    Local_Column++;
+                }
+            }
+
+            /**< Measure the opaque run */
+            Local_SpanStart = Local_Column;
+            while ((Local_Column < Copy_Width) && ((!Copy_Sheet->HasColorKey) || !GFX_IsTransparent(Copy_Sheet, Local_RowOffset + Local_Column)))
+            {
+                Local_Column++;
+            }
+
+            if (Local_Column > Local_SpanStart)
+            {
+                GFX_DrawSheetSpan(Copy_Device, Copy_Sheet, Local_RowOffset + Local_SpanStart, (u16)Local_XPosition + Local_SpanStart, (u16)Local_YPosition + Local_Row, Local_Column - Local_SpanStart);
+            }
+        }
+    }
+}
+
+void GFX_FillRect(const TFT_Device_t *Copy_Device, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color)
+{
+    if ((Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    GFX_FillArea(Copy_Device, Copy_XPosition, Copy_YPosition, (s32)Copy_XPosition + Copy_Width - 1, (s32)Copy_YPosition + Copy_Height - 1, Copy_Color);
+}
+
+void GFX_DrawRect(const TFT_Device_t *Copy_Device, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color)
+{
+    GFX_DrawRoundRect(Copy_Device, Copy_XPosition, Copy_YPosition, Copy_Width, Copy_Height, 0, Copy_Color);
+}
+
+void GFX_DrawLine(const TFT_Device_t *Copy_Device, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, u16 Copy_Color)
+{
+    s32 Local_X = Copy_X1;
+    s32 Local_Y = Copy_Y1;
+    s32 Local_dx = (Copy_X2 > Copy_X1) ? (Copy_X2 - Copy_X1) : (Copy_X1 - Copy_X2);    /**< Absolute difference in X */
+    s32 Local_dy = (Copy_Y2 > Copy_Y1) ? (Copy_Y1 - Copy_Y2) : (Copy_Y2 - Copy_Y1);    /**< Negative absolute difference in Y */
+    s32 Local_sx = (Copy_X1 < Copy_X2) ? 1 : -1;
+    s32 Local_sy = (Copy_Y1 < Copy_Y2) ? 1 : -1;
+    s32 Local_err = Local_dx + Local_dy;
+    s32 Local_e2;
+    s32 Local_NextX;
+    s32 Local_NextY;
+    u8 Local_XMajor = (Local_dx >= -Local_dy);
+    s32 Local_RunStart = Local_XMajor ? Local_X : Local_Y;
+
+    /**< Bresenham, but pixels are collected into runs along the major axis */
+    while ((Local_X != Copy_X2) || (Local_Y != Copy_Y2))
+    {
+        Local_e2 = 2 * Local_err;
+        Local_NextX = Local_X;
+        Local_NextY = Local_Y;
+
+        if (Local_e2 >= Local_dy)
+        {
+            Local_err += Local_dy;
+            Local_NextX += Local_sx;
+        }
+        if (Local_e2 <= Local_dx)
+        {
+            Local_err += Local_dx;
+            Local_NextY += Local_sy;
+        }
+
+        /**< The minor coordinate changes: the current run is complete */
+        if (Local_XMajor && (Local_NextY != Local_Y))
+        {
+            GFX_FillArea(Copy_Device, Local_RunStart, Local_Y, Local_X, Local_Y, Copy_Color);
+            Local_RunStart = Local_NextX;
+        }
+        else if ((!Local_XMajor) && (Local_NextX != Local_X))
+        {
+            GFX_FillArea(Copy_Device, Local_X, Local_RunStart, Local_X, Local_Y, Copy_Color);
+            Local_RunStart = Local_NextY;
+        }
+
+        Local_X = Local_NextX;
+        Local_Y = Local_NextY;
+    }
+
+    /**< Last run, it ends on the end point */
+    if (Local_XMajor)
+    {
+        GFX_FillArea(Copy_Device, Local_RunStart, Local_Y, Local_X, Local_Y, Copy_Color);
+    }
+    else
+    {
+        GFX_FillArea(Copy_Device, Local_X, Local_RunStart, Local_X, Local_Y, Copy_Color);
+    }
+}
+
+void GFX_DrawCircle(const TFT_Device_t *Copy_Device, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Color)
+{
+    GFX_DrawRoundedShape(Copy_Device, Copy_XCenter, Copy_YCenter, Copy_Radius, 0, 0, Copy_Color, 0);
+}
+
+void GFX_FillCircle(const TFT_Device_t *Copy_Device, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Color)
+{
+    GFX_DrawRoundedShape(Copy_Device, Copy_XCenter, Copy_YCenter, Copy_Radius, 0, 0, Copy_Color, 1);
+}
+
+void GFX_DrawRoundRect(const TFT_Device_t *Copy_Device, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Radius, u16 Copy_Color)
+{
+    u16 Local_MaxRadius;
+
+    if ((Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    /**< The corners may not overlap */
+    Local_MaxRadius = ((Copy_Width < Copy_Height) ? Copy_Width : Copy_Height) - 1;
+    Local_MaxRadius /= 2;
+    if (Copy_Radius > Local_MaxRadius)
+    {
+        Copy_Radius = Local_MaxRadius;
+    }
+
+    GFX_DrawRoundedShape(Copy_Device, (s32)Copy_XPosition + Copy_Radius, (s32)Copy_YPosition + Copy_Radius, Copy_Radius,
+                         (s32)Copy_Width - 1 - 2 * Copy_Radius, (s32)Copy_Height - 1 - 2 * Copy_Radius, Copy_Color, 0);
+}
+
+void GFX_FillRoundRect(const TFT_Device_t *Copy_Device, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Radius, u16 Copy_Color)
+{
+    u16 Local_MaxRadius;
+
+    if ((Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    /**< The corners may not overlap */
+    Local_MaxRadius = ((Copy_Width < Copy_Height) ? Copy_Width : Copy_Height) - 1;
+    Local_MaxRadius /= 2;
+    if (Copy_Radius > Local_MaxRadius)
+    {
+        Copy_Radius = Local_MaxRadius;
+    }
+
+    GFX_DrawRoundedShape(Copy_Device, (s32)Copy_XPosition + Copy_Radius, (s32)Copy_YPosition + Copy_Radius, Copy_Radius,
+                         (s32)Copy_Width - 1 - 2 * Copy_Radius, (s32)Copy_Height - 1 - 2 * Copy_Radius, Copy_Color, 1);
+}
+
+void GFX_DrawTriangle(const TFT_Device_t *Copy_Device, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, s16 Copy_X3, s16 Copy_Y3, u16 Copy_Color)
+{
+    GFX_DrawLine(Copy_Device, Copy_X1, Copy_Y1, Copy_X2, Copy_Y2, Copy_Color);
+    GFX_DrawLine(Copy_Device, Copy_X2, Copy_Y2, Copy_X3, Copy_Y3, Copy_Color);
+    GFX_DrawLine(Copy_Device, Copy_X3, Copy_Y3, Copy_X1, Copy_Y1, Copy_Color);
+}
+
+void GFX_FillTriangle(const TFT_Device_t *Copy_Device, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, s16 Copy_X3, s16 Copy_Y3, u16 Copy_Color)
+{
+    s32 Local_Swap;
+    s32 Local_Y;
+    s32 Local_XA;
+    s32 Local_XB;
+    s32 Local_YFirst;
+    s32 Local_YLast;
+
+    if (Copy_Device == NULL)
+    {
+        return;
+    }
+
+    /**< Sort the vertices by Y: (X1, Y1) on top, (X3, Y3) at the bottom */
+    if (Copy_Y1 > Copy_Y2)
+    {
+        Local_Swap = Copy_Y1; Copy_Y1 = Copy_Y2; Copy_Y2 = Local_Swap;
+        Local_Swap = Copy_X1; Copy_X1 = Copy_X2; Copy_X2 = Local_Swap;
+    }
+    if (Copy_Y2 > Copy_Y3)
+    {
+        Local_Swap = Copy_Y2; Copy_Y2 = Copy_Y3; Copy_Y3 = Local_Swap;
+        Local_Swap = Copy_X2; Copy_X2 = Copy_X3; Copy_X3 = Local_Swap;
+    }
+    if (Copy_Y1 > Copy_Y2)
+    {
+        Local_Swap = Copy_Y1; Copy_Y1 = Copy_Y2; Copy_Y2 = Local_Swap;
+        Local_Swap = Copy_X1; Copy_X1 = Copy_X2; Copy_X2 = Local_Swap;
+    }
+
+    /**< Degenerate triangle on one row */
+    if (Copy_Y1 == Copy_Y3)
+    {
+        Local_XA = Copy_X1;
+        Local_XB = Copy_X1;
+        if (Copy_X2 < Local_XA) { Local_XA = Copy_X2; }
+        if (Copy_X2 > Local_XB) { Local_XB = Copy_X2; }
+        if (Copy_X3 < Local_XA) { Local_XA = Copy_X3; }
+        if (Copy_X3 > Local_XB) { Local_XB = Copy_X3; }
+        GFX_FillArea(Copy_Device, Local_XA, Copy_Y1, Local_XB, Copy_Y1, Copy_Color);
+        return;
+    }
+
+    /**< Only the visible rows are rasterized */
+    Local_YFirst = (Copy_Y1 < 0) ? 0 : Copy_Y1;
+    Local_YLast = ((s32)Copy_Y3 >= (s32)TFT_GetHeight(Copy_Device)) ? ((s32)TFT_GetHeight(Copy_Device) - 1) : Copy_Y3;
+
+    /**< One run per row between the long edge (1-3) and the short edges (1-2 then 2-3) */
+    for (Local_Y = Local_YFirst; Local_Y <= Local_YLast; Local_Y++)
+    {
+        Local_XA = Copy_X1 + ((s32)(Copy_X3 - Copy_X1) * (Local_Y - Copy_Y1)) / (Copy_Y3 - Copy_Y1);
+
+        if ((Local_Y < Copy_Y2) || ((Local_Y == Copy_Y2) && (Copy_Y2 == Copy_Y1)))
+        {
+            Local_XB = (Copy_Y2 == Copy_Y1) ? Copy_X2 : (Copy_X1 + ((s32)(Copy_X2 - Copy_X1) * (Local_Y - Copy_Y1)) / (Copy_Y2 - Copy_Y1));
+        }
+        else
+        {
+            Local_XB = (Copy_Y3 == Copy_Y2) ? Copy_X2 : (Copy_X2 + ((s32)(Copy_X3 - Copy_X2) * (Local_Y - Copy_Y2)) / (Copy_Y3 - Copy_Y2));
+        }
+
+        GFX_FillArea(Copy_Device, Local_XA, Local_Y, Local_XB, Local_Y, Copy_Color);
+    }
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void GFX_FillArea(const TFT_Device_t *Copy_Device, s32 Copy_X1, s32 Copy_Y1, s32 Copy_X2, s32 Copy_Y2, u16 Copy_Color)
+{
+    s32 Local_Swap;
+    s32 Local_ScreenWidth;
+    s32 Local_ScreenHeight;
+
+    if (Copy_Device == NULL)
+    {
+        return;
+    }
+
+    Local_ScreenWidth = TFT_GetWidth(Copy_Device);
+    Local_ScreenHeight = TFT_GetHeight(Copy_Device);
+
+    /**< Order the corners */
+    if (Copy_X1 > Copy_X2)
+    {
+        Local_Swap = Copy_X1; Copy_X1 = Copy_X2; Copy_X2 = Local_Swap;
+    }
+    if (Copy_Y1 > Copy_Y2)
+    {
+        Local_Swap = Copy_Y1; Copy_Y1 = Copy_Y2; Copy_Y2 = Local_Swap;
+    }
+
+    /**< Clip to the screen */
+    if ((Copy_X2 < 0) || (Copy_Y2 < 0) || (Copy_X1 >= Local_ScreenWidth) || (Copy_Y1 >= Local_ScreenHeight))
+    {
+        return;
+    }
+    if (Copy_X1 < 0)
+    {
+        Copy_X1 = 0;
+    }
+    if (Copy_Y1 < 0)
+    {
+        Copy_Y1 = 0;
+    }
+    if (Copy_X2 >= Local_ScreenWidth)
+    {
+        Copy_X2 = Local_ScreenWidth - 1;
+    }
+    if (Copy_Y2 >= Local_ScreenHeight)
+    {
+        Copy_Y2 = Local_ScreenHeight - 1;
+    }
+
+    TFT_FillRect(Copy_Device, (u16)Copy_X1, (u16)Copy_Y1, (u16)(Copy_X2 - Copy_X1 + 1), (u16)(Copy_Y2 - Copy_Y1 + 1), Copy_Color);
+}
+
+static void GFX_DrawRoundedShape(const TFT_Device_t *Copy_Device, s32 Copy_XCenter, s32 Copy_YCenter, s32 Copy_Radius, s32 Copy_StretchX, s32 Copy_StretchY, u16 Copy_Color, u8 Copy_Filled)
+{
+    s32 Local_Limit = Copy_Radius * Copy_Radius + Copy_Radius;   /**< Points with x^2 + y^2 <= r^2 + r are inside */
+    s32 Local_HalfWidth = Copy_Radius;                           /**< Half width of the arc on the current row */
+    s32 Local_NextHalfWidth;                                     /**< Half width of the arc on the next row out */
+    s32 Local_Inner;
+    s32 Local_Dy;
+    s32 Local_Left;
+    s32 Local_Right = Copy_XCenter + Copy_StretchX;
+    s32 Local_Bottom = Copy_YCenter + Copy_StretchY;
+
+    if (Copy_Filled)
+    {
+        /**< The straight middle band, one window */
+        GFX_FillArea(Copy_Device, Copy_XCenter - Copy_Radius, Copy_YCenter, Local_Right + Copy_Radius, Local_Bottom, Copy_Color);
+    }
+    else if (Copy_StretchY > 1)
+    {
+        /**< The straight left and right edges */
+        GFX_FillArea(Copy_Device, Copy_XCenter - Copy_Radius, Copy_YCenter + 1, Copy_XCenter - Copy_Radius, Local_Bottom - 1, Copy_Color);
+        GFX_FillArea(Copy_Device, Local_Right + Copy_Radius, Copy_YCenter + 1, Local_Right + Copy_Radius, Local_Bottom - 1, Copy_Color);
+    }
+
+    for (Local_Dy = 0; Local_Dy <= Copy_Radius; Local_Dy++)
+    {
+        /**< Shrink the half width for the next row, the x^2 + y^2 test is all the math needed */
+        Local_NextHalfWidth = Local_HalfWidth;
+        while ((Local_NextHalfWidth >= 0) && ((Local_NextHalfWidth * Local_NextHalfWidth + (Local_Dy + 1) * (Local_Dy + 1)) > Local_Limit))
+        {
+            Local_NextHalfWidth--;
+        }
+
+        Local_Left = Copy_XCenter - Local_HalfWidth;
+
+        if (Copy_Filled)
+        {
+            /**< Row 0 belongs to the middle band */
+            if (Local_Dy > 0)
+            {
+                GFX_FillArea(Copy_Device, Local_Left, Copy_YCenter - Local_Dy, Local_Right + Local_HalfWidth, Copy_YCenter - Local_Dy, Copy_Color);
+                GFX_FillArea(Copy_Device, Local_Left, Local_Bottom + Local_Dy, Local_Right + Local_HalfWidth, Local_Bottom + Local_Dy, Copy_Color);
+            }
+        }
+        else
+        {
+            /**< The outline covers the pixels not covered by the next row out, at least one per side */
+            Local_Inner = Local_NextHalfWidth + 1;
+            if (Local_Inner > Local_HalfWidth)
+            {
+                Local_Inner = Local_HalfWidth;
+            }
+
+            if ((Local_NextHalfWidth < 0) || ((Copy_StretchX + 2 * Local_Inner) <= 1))
+            {
+                /**< Outermost row or both sides touching: one run across */
+                GFX_FillArea(Copy_Device, Local_Left, Copy_YCenter - Local_Dy, Local_Right + Local_HalfWidth, Copy_YCenter - Local_Dy, Copy_Color);
+                if ((Local_Dy > 0) || (Copy_StretchY > 0))
+                {
+                    GFX_FillArea(Copy_Device, Local_Left, Local_Bottom + Local_Dy, Local_Right + Local_HalfWidth, Local_Bottom + Local_Dy, Copy_Color);
+                }
+            }
+            else
+            {
+                GFX_FillArea(Copy_Device, Local_Left, Copy_YCenter - Local_Dy, Copy_XCenter - Local_Inner, Copy_YCenter - Local_Dy, Copy_Color);
+                GFX_FillArea(Copy_Device, Local_Right + Local_Inner, Copy_YCenter - Local_Dy, Local_Right + Local_HalfWidth, Copy_YCenter - Local_Dy, Copy_Color);
+                if ((Local_Dy > 0) || (Copy_StretchY > 0))
+                {
+                    GFX_FillArea(Copy_Device, Local_Left, Local_Bottom + Local_Dy, Copy_XCenter - Local_Inner, Local_Bottom + Local_Dy, Copy_Color);
+                    GFX_FillArea(Copy_Device, Local_Right + Local_Inner, Local_Bottom + Local_Dy, Local_Right + Local_HalfWidth, Local_Bottom + Local_Dy, Copy_Color);
+                }
+            }
+        }
+
+        Local_HalfWidth = Local_NextHalfWidth;
+    }
+}
+static u8 GFX_IsTransparent(const GFX_Sheet_t *Copy_Sheet, u32 Copy_Offset)
+{
+    if (Copy_Sheet->Format == GFX_FORMAT_INDEXED8)
+    {
+        return (((const u8 *)Copy_Sheet->Pixels)[Copy_Offset] == Copy_Sheet->ColorKey);
+    }
+
+    return (((const u16 *)Copy_Sheet->Pixels)[Copy_Offset] == Copy_Sheet->ColorKey);
+}
+
+static void GFX_DrawSheetSpan(const TFT_Device_t *Copy_Device, const GFX_Sheet_t *Copy_Sheet, u32 Copy_Offset, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length)
+{
+    u16 Local_Buffer[GFX_SPAN_BUFFER_PIXELS];
+    const u8 *Local_Indexes;
+    u16 Local_Chunk;
+    u16 Local_Iterator;
+
+    if (Copy_Sheet->Format == GFX_FORMAT_RGB565)
+    {
+        /**< The run is already in the panel format, send it straight from the sheet */
+        TFT_DrawBitmap(Copy_Device, Copy_XPosition, Copy_YPosition, Copy_Length, 1, &((const u16 *)Copy_Sheet->Pixels)[Copy_Offset]);
+        return;
+    }
+
+    /**< Expand the palette indexes chunk by chunk */
+    Local_Indexes = &((const u8 *)Copy_Sheet->Pixels)[Copy_Offset];
+    while (Copy_Length > 0)
+    {
+        Local_Chunk = (Copy_Length > GFX_SPAN_BUFFER_PIXELS) ? GFX_SPAN_BUFFER_PIXELS : Copy_Length;
+
+        for (Local_Iterator = 0; Local_Iterator < Local_Chunk; Local_Iterator++)
+        {
+            Local_Buffer[Local_Iterator] = Copy_Sheet->Palette[Local_Indexes[Local_Iterator]];
+        }
+
+        TFT_DrawBitmap(Copy_Device, Copy_XPosition, Copy_YPosition, Local_Chunk, 1, Local_Buffer);
+
+        Local_Indexes += Local_Chunk;
+        Copy_XPosition += Local_Chunk;
+        Copy_Length -= Local_Chunk;
+    }
+}
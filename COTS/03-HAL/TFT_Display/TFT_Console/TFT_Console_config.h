@@ -0,0 +1,30 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Console_config.h
+ * @brief This file contains the configuration options for the TFT console widget.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_CONSOLE_CONFIG_H__
+#define __TFT_CONSOLE_CONFIG_H__
+
+/**
+ * @brief Default text color in 16-bit RGB565 format (white).
+ */
+#define TFT_CONSOLE_TEXT_COLOR          0xFFFF
+
+/**
+ * @brief Default background color in 16-bit RGB565 format (black).
+ */
+#define TFT_CONSOLE_BACKGROUND_COLOR    0x0000
+
+/**
+ * @brief Number of cells between two tab stops.
+ */
+#define TFT_CONSOLE_TAB_SIZE            4
+
+#endif /**< __TFT_CONSOLE_CONFIG_H__ */
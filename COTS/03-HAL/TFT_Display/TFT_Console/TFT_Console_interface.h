@@ -0,0 +1,91 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Console_interface.h
+ * @brief This file contains the interface of the TFT console widget.
+ *
+ * The console renders a text terminal on a TFT panel. New lines are made with the controller
+ * hardware vertical scrolling, so scrolling costs one command and one cleared text line instead
+ * of redrawing the whole screen. It is typically fed with the same bytes sent over UART to mirror
+ * the log output on the panel.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_CONSOLE_INTERFACE_H__
+#define __TFT_CONSOLE_INTERFACE_H__
+
+/**
+ * @note Include TFT_Device_interface.h before this file.
+ */
+
+/**
+ * @addtogroup TFT_Console_Functions
+ * @{
+ */
+
+/**
+ * @brief Initializes the console on an initialized TFT display.
+ *
+ * This function sizes the console to the panel, sets the text rows as the scrolling area, resets the scroll
+ * position and the cursor, and clears the panel with the console background color.
+ *
+ * @param[in] Copy_Device Pointer to the display, it must stay valid while the console is used.
+ * @return E_OK, or E_NOT_OK when Copy_Device is NULL or its orientation does not scroll along the screen rows.
+ *
+ * @note The display must be initialized by its driver first and must use the TFT_ROTATION_0 orientation (TFT_MIRROR_X
+ *       is allowed): the hardware scrolling runs along the frame memory lines, and the console uses them as screen rows.
+ *       In the other orientations the console is left unused, see TFT_IsScrollAlongRows().
+ */
+Std_ReturnType TFT_ConsoleInit(const TFT_Device_t *Copy_Device);
+
+/**
+ * @brief Sets the colors used for the characters written after this call.
+ *
+ * @param[in] Copy_TextColor The text color in 16-bit RGB565 format.
+ * @param[in] Copy_BackgroundColor The background color in 16-bit RGB565 format.
+ * @retval None
+ */
+void TFT_ConsoleSetColors(u16 Copy_TextColor, u16 Copy_BackgroundColor);
+
+/**
+ * @brief Clears the console and moves the cursor to the top-left cell.
+ *
+ * @retval None
+ */
+void TFT_ConsoleClear(void);
+
+/**
+ * @brief Writes one character at the cursor position.
+ *
+ * Printable characters are drawn and advance the cursor, wrapping at the right edge.
+ * '\n' starts a new line, '\r' returns to the first column, '\t' moves to the next tab stop
+ * and '\b' moves one cell back. Starting a new line on the last row scrolls the console up by one line.
+ *
+ * @param[in] Copy_Character The character to write.
+ * @retval None
+ */
+void TFT_ConsoleWriteChar(u8 Copy_Character);
+
+/**
+ * @brief Writes a block of bytes, e.g. a buffer sent or received over UART.
+ *
+ * @param[in] Copy_Data Pointer to the bytes to write.
+ * @param[in] Copy_Size The number of bytes to write.
+ * @retval None
+ */
+void TFT_ConsoleWrite(const u8 *Copy_Data, u16 Copy_Size);
+
+/**
+ * @brief Writes a null-terminated string.
+ *
+ * @param[in] Copy_String Pointer to the string to write.
+ * @retval None
+ */
+void TFT_ConsoleWriteString(const char *Copy_String);
+
+/** @} TFT_Console_Functions */
+
+#endif /**< __TFT_CONSOLE_INTERFACE_H__ */
@@ -0,0 +1,43 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Console_private.h
+ * @brief This file contains the private definitions of the TFT console widget.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_CONSOLE_PRIVATE_H__
+#define __TFT_CONSOLE_PRIVATE_H__
+
+/**
+ * @brief Size of one character cell: a 5x7 glyph plus one column and one row of spacing.
+ */
+#define TFT_CONSOLE_CELL_WIDTH          (FONT_5X7_WIDTH + 1)
+#define TFT_CONSOLE_CELL_HEIGHT         (FONT_5X7_HEIGHT + 1)
+
+/**
+ * @brief Starts a new line, scrolling the console up when the cursor is on the last row.
+ */
+static void TFT_ConsoleNewLine(void);
+
+/**
+ * @brief Draws one character into a cell.
+ *
+ * @param Copy_Column The cell column.
+ * @param Copy_Row The cell row on the screen (0 is the top visible row).
+ * @param Copy_Character The character to draw.
+ */
+static void TFT_ConsoleDrawCell(u8 Copy_Column, u8 Copy_Row, u8 Copy_Character);
+
+/**
+ * @brief Converts a screen row to the frame memory line where it currently starts.
+ *
+ * @param Copy_Row The cell row on the screen (0 is the top visible row).
+ * @return The frame memory line of the first pixel row of the cell.
+ */
+static u16 TFT_ConsoleRowToLine(u8 Copy_Row);
+
+#endif /**< __TFT_CONSOLE_PRIVATE_H__ */
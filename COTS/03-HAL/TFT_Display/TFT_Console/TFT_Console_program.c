@@ -0,0 +1,213 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Console_program.c
+ * @brief This file contains the implementation of the TFT console widget.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< SERVICES */
+#include "FONT_interface.h"
+/**< HAL */
+#include "TFT_Device_interface.h"
+#include "TFT_Console_config.h"
+#include "TFT_Console_private.h"
+#include "TFT_Console_interface.h"
+
+/**< Console state */
+static const TFT_Device_t *TFT_ConsoleDisplay = NULL;
+static u8 TFT_ConsoleColumns = 0;
+static u8 TFT_ConsoleRows = 0;
+static u16 TFT_ConsoleScrollLines = 0;   /**< Height of the scrolling area, a whole number of text rows */
+static u16 TFT_ConsoleTextColor = TFT_CONSOLE_TEXT_COLOR;
+static u16 TFT_ConsoleBackgroundColor = TFT_CONSOLE_BACKGROUND_COLOR;
+static u8 TFT_ConsoleColumn = 0;
+static u8 TFT_ConsoleRow = 0;
+static u16 TFT_ConsoleScrollLine = 0;    /**< Frame memory line currently shown at the top of the panel */
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+Std_ReturnType TFT_ConsoleInit(const TFT_Device_t *Copy_Device)
+{
+    /**< The console stays unused until a display is accepted */
+    TFT_ConsoleDisplay = NULL;
+
+    /**< The scroll lines are used as screen rows, the 90 and 270 degrees rotations scroll along X and 180 degrees upwards */
+    if ((Copy_Device == NULL) || !TFT_IsScrollAlongRows(Copy_Device))
+    {
+        return E_NOT_OK;
+    }
+
+    TFT_ConsoleDisplay = Copy_Device;
+    TFT_ConsoleColumns = TFT_GetWidth(Copy_Device) / TFT_CONSOLE_CELL_WIDTH;
+    TFT_ConsoleRows = TFT_GetHeight(Copy_Device) / TFT_CONSOLE_CELL_HEIGHT;
+    TFT_ConsoleScrollLines = (u16)TFT_ConsoleRows * TFT_CONSOLE_CELL_HEIGHT;
+
+    /**< The text rows scroll, the remaining frame memory lines are kept fixed below them */
+    TFT_SetScrollArea(TFT_ConsoleDisplay, 0, Copy_Device->FrameMemoryLines - TFT_ConsoleScrollLines);
+
+    TFT_ConsoleClear();
+
+    return E_OK;
+}
+
+void TFT_ConsoleSetColors(u16 Copy_TextColor, u16 Copy_BackgroundColor)
+{
+    TFT_ConsoleTextColor = Copy_TextColor;
+    TFT_ConsoleBackgroundColor = Copy_BackgroundColor;
+}
+
+void TFT_ConsoleClear(void)
+{
+    if (TFT_ConsoleDisplay == NULL)
+    {
+        return;
+    }
+
+    TFT_ConsoleScrollLine = 0;
+    TFT_SetScrollStart(TFT_ConsoleDisplay, TFT_ConsoleScrollLine);
+    TFT_FillRect(TFT_ConsoleDisplay, 0, 0, TFT_ConsoleDisplay->Width, TFT_ConsoleDisplay->Height, TFT_ConsoleBackgroundColor);
+
+    TFT_ConsoleColumn = 0;
+    TFT_ConsoleRow = 0;
+}
+
+void TFT_ConsoleWriteChar(u8 Copy_Character)
+{
+    if (TFT_ConsoleDisplay == NULL)
+    {
+        return;
+    }
+
+    switch (Copy_Character)
+    {
+    case '\n':
+        TFT_ConsoleNewLine();
+        break;
+
+    case '\r':
+        TFT_ConsoleColumn = 0;
+        break;
+
+    case '\t':
+        /**< Pad with spaces up to the next tab stop */
+        do
+        {
+            TFT_ConsoleWriteChar(' ');
+        } while ((TFT_ConsoleColumn % TFT_CONSOLE_TAB_SIZE) != 0);
+        break;
+
+    case '\b':
+        if (TFT_ConsoleColumn > 0)
+        {
+            TFT_ConsoleColumn--;
+        }
+        break;
+
+    default:
+        TFT_ConsoleDrawCell(TFT_ConsoleColumn, TFT_ConsoleRow, Copy_Character);
+        TFT_ConsoleColumn++;
+
+        /**< Wrap long lines */
+        if (TFT_ConsoleColumn >= TFT_ConsoleColumns)
+        {
+            TFT_ConsoleNewLine();
+        }
+        break;
+    }
+}
+
+void TFT_ConsoleWrite(const u8 *Copy_Data, u16 Copy_Size)
+{
+    u16 Local_Iterator;
+
+    if (Copy_Data == NULL)
+    {
+        return;
+    }
+
+    for (Local_Iterator = 0; Local_Iterator < Copy_Size; Local_Iterator++)
+    {
+        TFT_ConsoleWriteChar(Copy_Data[Local_Iterator]);
+    }
+}
+
+void TFT_ConsoleWriteString(const char *Copy_String)
+{
+    if (Copy_String == NULL)
+    {
+        return;
+    }
+
+    while (*Copy_String != '\0')
+    {
+        TFT_ConsoleWriteChar((u8)*Copy_String);
+        Copy_String++;
+    }
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void TFT_ConsoleNewLine(void)
+{
+    TFT_ConsoleColumn = 0;
+
+    if (TFT_ConsoleRow < (TFT_ConsoleRows - 1))
+    {
+        TFT_ConsoleRow++;
+        return;
+    }
+
+    /**< On the last row: blank the top text line, it becomes the new bottom line once the scroll start moves past it */
+    TFT_FillRect(TFT_ConsoleDisplay, 0, TFT_ConsoleScrollLine, TFT_ConsoleDisplay->Width, TFT_CONSOLE_CELL_HEIGHT, TFT_ConsoleBackgroundColor);
+
+    TFT_ConsoleScrollLine += TFT_CONSOLE_CELL_HEIGHT;
+    if (TFT_ConsoleScrollLine >= TFT_ConsoleScrollLines)
+    {
+        TFT_ConsoleScrollLine = 0;
+    }
+    TFT_SetScrollStart(TFT_ConsoleDisplay, TFT_ConsoleScrollLine);
+}
+
+static void TFT_ConsoleDrawCell(u8 Copy_Column, u8 Copy_Row, u8 Copy_Character)
+{
+    u16 Local_Cell[TFT_CONSOLE_CELL_WIDTH * TFT_CONSOLE_CELL_HEIGHT];
+    const u8 *Local_Glyph = FONT_GetGlyph5x7(Copy_Character);
+    u8 Local_X;
+    u8 Local_Y;
+
+    /**< Expand the column-major glyph into a row-major cell, the spacing column and row stay background */
+    for (Local_Y = 0; Local_Y < TFT_CONSOLE_CELL_HEIGHT; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < TFT_CONSOLE_CELL_WIDTH; Local_X++)
+        {
+            if ((Local_X < FONT_5X7_WIDTH) && (Local_Y < FONT_5X7_HEIGHT) && GET_BIT(Local_Glyph[Local_X], Local_Y))
+            {
+                Local_Cell[Local_Y * TFT_CONSOLE_CELL_WIDTH + Local_X] = TFT_ConsoleTextColor;
+            }
+            else
+            {
+                Local_Cell[Local_Y * TFT_CONSOLE_CELL_WIDTH + Local_X] = TFT_ConsoleBackgroundColor;
+            }
+        }
+    }
+
+    /**< One window and one burst per character */
+    TFT_DrawBitmap(TFT_ConsoleDisplay, Copy_Column * TFT_CONSOLE_CELL_WIDTH, TFT_ConsoleRowToLine(Copy_Row), TFT_CONSOLE_CELL_WIDTH, TFT_CONSOLE_CELL_HEIGHT, Local_Cell);
+}
+
+static u16 TFT_ConsoleRowToLine(u8 Copy_Row)
+{
+    u16 Local_Line = TFT_ConsoleScrollLine + (u16)Copy_Row * TFT_CONSOLE_CELL_HEIGHT;
+
+    /**< The scrolling area wraps after the last text row */
+    if (Local_Line >= TFT_ConsoleScrollLines)
+    {
+        Local_Line -= TFT_ConsoleScrollLines;
+    }
+
+    return Local_Line;
+}
@@ -0,0 +1,23 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Device_config.h
+ * @brief This file contains the configuration options shared by all the TFT display devices.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_DEVICE_CONFIG_H__
+#define __TFT_DEVICE_CONFIG_H__
+
+/**
+ * @brief Defines the default background color for the TFT displays.
+ *
+ * This option should be set to the color used when clearing a display, in 16-bit RGB565 format.
+ * Any @ref TFT_Color_t value can be used.
+ */
+#define TFT_DEFAULT_BACKGROUND_COLOR    TFT_COLOR_BLACK
+
+#endif /**< __TFT_DEVICE_CONFIG_H__ */
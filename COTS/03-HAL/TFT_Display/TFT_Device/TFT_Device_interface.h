@@ -0,0 +1,306 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Device_interface.h
+ * @brief This file contains the common interface of the TFT display devices.
+ *
+ * Every TFT controller driver (ST7735S, HX8357B, ILI9481) fills a TFT_Device_t with its
+ * low-level operations: set the address window, push pixels, fill with one color and write
+ * a command. Everything above that (clipping, orientation, scrolling, fills, bitmaps, and the
+ * GFX and console modules) is written once against TFT_Device_t, so any panel can use it and
+ * several panels can be driven at the same time.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_DEVICE_INTERFACE_H__
+#define __TFT_DEVICE_INTERFACE_H__
+
+/**
+ * @addtogroup TFT_Device_Types
+ * @{
+ */
+
+/**
+ * @brief Enumeration of common colors in 16-bit RGB565 format.
+ */
+typedef enum
+{
+    TFT_COLOR_BLACK         = 0x0000,   /**< Black color (0, 0, 0) */
+    TFT_COLOR_WHITE         = 0xFFFF,   /**< White color (255, 255, 255) */
+    TFT_COLOR_RED           = 0xF800,   /**< Red color (255, 0, 0) */
+    TFT_COLOR_GREEN         = 0x07E0,   /**< Green color (0, 255, 0) */
+    TFT_COLOR_BLUE          = 0x001F,   /**< Blue color (0, 0, 255) */
+    TFT_COLOR_YELLOW        = 0xFFE0,   /**< Yellow color (255, 255, 0) */
+    TFT_COLOR_MAGENTA       = 0xF81F,   /**< Magenta color (255, 0, 255) */
+    TFT_COLOR_CYAN          = 0x07FF,   /**< Cyan color (0, 255, 255) */
+    TFT_COLOR_GRAY          = 0x7BEF,   /**< Gray color (128, 128, 128) */
+    TFT_COLOR_ORANGE        = 0xFD20,   /**< Orange color (255, 165, 0) */
+    TFT_COLOR_PINK          = 0xFC18,   /**< Pink color (255, 192, 203) */
+    TFT_COLOR_PURPLE        = 0x8010,   /**< Purple color (128, 0, 128) */
+    TFT_COLOR_BROWN         = 0xA145,   /**< Brown color (165, 42, 42) */
+    TFT_COLOR_GOLD          = 0xFEA0,   /**< Gold color (255, 215, 0) */
+    TFT_COLOR_SILVER        = 0xC618    /**< Silver color (192, 192, 192) */
+} TFT_Color_t;
+
+/**
+ * @brief Enumeration of the display rotations, measured clockwise from the natural orientation.
+ */
+typedef enum
+{
+    TFT_ROTATION_0 = 0,     /**< Natural orientation */
+    TFT_ROTATION_90,        /**< Rotated 90 degrees, width and height are swapped */
+    TFT_ROTATION_180,       /**< Rotated 180 degrees */
+    TFT_ROTATION_270        /**< Rotated 270 degrees, width and height are swapped */
+} TFT_Rotation_t;
+
+/**
+ * @brief Mirror flags for TFT_SetOrientation(), they can be ORed together.
+ */
+#define TFT_MIRROR_NONE     0x00    /**< No mirroring */
+#define TFT_MIRROR_X        0x01    /**< Mirror left to right on the rotated screen */
+#define TFT_MIRROR_Y        0x02    /**< Mirror top to bottom on the rotated screen */
+
+/**
+ * @struct TFT_PinPairs
+ * @brief Structure to represent GPIO port and pin pairs for TFT signals.
+ *
+ * This structure defines pairs of GPIO port index and pin number that are used to represent TFT signals.
+ * It is designed to be used in configurations for interfacing with TFT modules.
+ */
+typedef struct {
+    u8 TFT_Port : 4; /**< GPIO port index for TFT signals (3 bits). */
+    u8 TFT_Pin  : 4; /**< Pin number for TFT signals (4 bits). */
+} TFT_PinPairs;
+
+/**
+ * @brief RGB565 to RGB666 conversion for controllers configured for 18-bit pixels.
+ *
+ * Each channel is sent as one byte holding the 6-bit value in bits 7..2. The 5-bit red and blue
+ * channels are widened through TFT_Rgb666From5Bit[] (the top bit is replicated into the new low
+ * bit, so full scale stays full scale); the 6-bit green channel only needs a shift. Drivers use
+ * these in their pixel streaming loops, there is no intermediate 18-bit buffer.
+ */
+#define TFT_RGB666_RED(COLOR)   (TFT_Rgb666From5Bit[((COLOR) >> 11) & 0x1F])    /**< Red byte of an RGB565 color */
+#define TFT_RGB666_GREEN(COLOR) ((u8)(((COLOR) >> 3) & 0xFC))                  /**< Green byte of an RGB565 color */
+#define TFT_RGB666_BLUE(COLOR)  (TFT_Rgb666From5Bit[(COLOR) & 0x1F])            /**< Blue byte of an RGB565 color */
+
+extern const u8 TFT_Rgb666From5Bit[32];
+
+/**
+ * @brief Command sequence encoding for TFT_SendCommandSequence().
+ *
+ * A sequence is a list of records: the command byte, the parameter count, the parameters, and
+ * when the count has TFT_SEQ_DELAY set, a 16-bit delay in milliseconds (TFT_SEQ_MS()). The list
+ * ends with TFT_SEQ_END. A record holds at most 126 parameters.
+ *
+ * @code{c}
+ * static const u8 Sequence[] = {
+ *     0x11, 0 | TFT_SEQ_DELAY, TFT_SEQ_MS(120),    // Sleep out, then wait 120 ms
+ *     0x3A, 1, 0x55,                               // 16-bit pixels
+ *     TFT_SEQ_END
+ * };
+ * @endcode
+ */
+#define TFT_SEQ_DELAY           0x80                                    /**< A delay follows the parameters */
+#define TFT_SEQ_COUNT_MASK      0x7F                                    /**< Parameter count bits */
+#define TFT_SEQ_END_MARKER      0xFF                                    /**< Parameter count of the end record */
+#define TFT_SEQ_MS(ms)          (((ms) >> 8) & 0xFF), ((ms) & 0xFF)     /**< Encodes a delay in milliseconds */
+#define TFT_SEQ_END             0x00, TFT_SEQ_END_MARKER                /**< Ends a sequence */
+
+typedef struct TFT_Device_t TFT_Device_t;
+
+/**
+ * @brief Low-level operations implemented by each controller driver.
+ *
+ * These are the only functions that touch the bus, so they are the only ones a new panel has to provide.
+ * Coordinates are in the current orientation, already clipped by the caller.
+ */
+typedef struct
+{
+    /**< Open the address window (inclusive corners) and start a memory write */
+    void (*SetWindow)(const TFT_Device_t *Copy_Device, u16 Copy_XStart, u16 Copy_YStart, u16 Copy_XEnd, u16 Copy_YEnd);
+
+    /**< Stream RGB565 pixels into the open window */
+    void (*PushPixels)(const TFT_Device_t *Copy_Device, const u16 *Copy_Pixels, u32 Copy_Count);
+
+    /**< Stream one RGB565 color Copy_Count times into the open window */
+    void (*Fill)(const TFT_Device_t *Copy_Device, u16 Copy_Color, u32 Copy_Count);
+
+    /**< Send a command followed by its parameter bytes */
+    void (*WriteCommand)(const TFT_Device_t *Copy_Device, u8 Copy_Command, const u8 *Copy_Params, u8 Copy_ParamCount);
+} TFT_DeviceOps_t;
+
+/**
+ * @brief A TFT display instance.
+ *
+ * The structure is filled by the driver initialization function (e.g. TFT_ST7735S_Init()) and then
+ * passed to all the drawing functions. The application only allocates it.
+ */
+struct TFT_Device_t
+{
+    const TFT_DeviceOps_t *Ops;     /**< Low-level operations of the controller driver */
+    const void *Config;             /**< Driver configuration (bus and pins), used by the driver only */
+    u16 NativeWidth;                /**< Panel width in the natural orientation */
+    u16 NativeHeight;               /**< Panel height in the natural orientation */
+    u16 FrameMemoryLines;           /**< Lines in the controller frame memory, for the scrolling definition */
+    u8 MadctlNatural;               /**< MADCTL value of the natural orientation */
+    u8 Madctl;                      /**< MADCTL value of the current orientation */
+    u16 Width;                      /**< Width in the current orientation */
+    u16 Height;                     /**< Height in the current orientation */
+};
+
+/** @} TFT_Device_Types */
+
+/**
+ * @addtogroup TFT_Device_Functions
+ * @{
+ */
+
+/**
+ * @brief Sends a command sequence to the display.
+ *
+ * This function is mainly used by the drivers to run their initialization tables.
+ *
+ * @param[in] Copy_Device Pointer to the initialized display.
+ * @param[in] Copy_Sequence Pointer to the sequence, see @ref TFT_SEQ_END for the encoding.
+ * @retval None
+ */
+void TFT_SendCommandSequence(const TFT_Device_t *Copy_Device, const u8 *Copy_Sequence);
+
+/**
+ * @brief Sets the rotation and mirroring of the display.
+ *
+ * This function reprograms the controller MADCTL register so the address window is scanned in the
+ * orientation of the mounted panel. Images and text are then streamed in their natural order whatever
+ * the mounting is, and all the drawing functions use the rotated width and height as their limits.
+ *
+ * @param[in,out] Copy_Device Pointer to the display.
+ * @param[in] Copy_Rotation The rotation, see @ref TFT_Rotation_t.
+ * @param[in] Copy_Mirror Mirror flags, @ref TFT_MIRROR_NONE or a combination of @ref TFT_MIRROR_X and @ref TFT_MIRROR_Y.
+ * @retval None
+ *
+ * @note The hardware vertical scrolling always moves along the frame memory rows, i.e. it scrolls
+ *       vertically in the 0 and 180 degrees rotations and horizontally in the 90 and 270 degrees rotations.
+ */
+void TFT_SetOrientation(TFT_Device_t *Copy_Device, TFT_Rotation_t Copy_Rotation, u8 Copy_Mirror);
+
+/**
+ * @brief Gets the display width in the current orientation.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @retval The number of pixels in one row of the rotated screen, 0 when Copy_Device is NULL.
+ */
+u16 TFT_GetWidth(const TFT_Device_t *Copy_Device);
+
+/**
+ * @brief Gets the display height in the current orientation.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @retval The number of rows of the rotated screen, 0 when Copy_Device is NULL.
+ */
+u16 TFT_GetHeight(const TFT_Device_t *Copy_Device);
+
+/**
+ * @brief Clears the screen by filling it with the default background color.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @retval None
+ */
+void TFT_ClearScreen(const TFT_Device_t *Copy_Device);
+
+/**
+ * @brief Draws one pixel.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @param[in] Copy_XPosition The X-coordinate of the pixel.
+ * @param[in] Copy_YPosition The Y-coordinate of the pixel.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @retval None
+ */
+void TFT_DrawPixel(const TFT_Device_t *Copy_Device, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Color);
+
+/**
+ * @brief Fills a rectangle with a single color.
+ *
+ * This function opens one address window covering the rectangle and streams the color as one burst.
+ * The rectangle is clipped to the screen.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The width of the rectangle in pixels.
+ * @param[in] Copy_Height The height of the rectangle in pixels.
+ * @param[in] Copy_Color The fill color in 16-bit RGB565 format.
+ * @retval None
+ */
+void TFT_FillRect(const TFT_Device_t *Copy_Device, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color);
+
+/**
+ * @brief Draws an RGB565 bitmap at the specified position.
+ *
+ * This function opens one address window for the bitmap and streams its pixels row by row.
+ * Pixels falling outside the screen are clipped.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The width of the bitmap in pixels.
+ * @param[in] Copy_Height The height of the bitmap in pixels.
+ * @param[in] Copy_Bitmap Pointer to Copy_Width * Copy_Height pixels in RGB565 format, row by row.
+ * @retval None
+ */
+void TFT_DrawBitmap(const TFT_Device_t *Copy_Device, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Bitmap);
+
+/**
+ * @brief Displays a full screen image.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @param[in] Copy_Image Pointer to width * height pixels in RGB565 format, in the current orientation.
+ * @retval None
+ */
+void TFT_DisplayImage(const TFT_Device_t *Copy_Device, const u16 *Copy_Image);
+
+/**
+ * @brief Defines the hardware vertical scrolling area.
+ *
+ * The frame memory is split into a top fixed area, a scrolling area and a bottom fixed area; the scrolling
+ * area is whatever remains of the frame memory lines after the two fixed areas.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @param[in] Copy_TopFixedLines The number of lines at the top of the frame memory that do not scroll.
+ * @param[in] Copy_BottomFixedLines The number of lines at the bottom of the frame memory that do not scroll.
+ * @retval None
+ *
+ * @note The request is ignored if the fixed areas together exceed the frame memory.
+ */
+void TFT_SetScrollArea(const TFT_Device_t *Copy_Device, u16 Copy_TopFixedLines, u16 Copy_BottomFixedLines);
+
+/**
+ * @brief Sets the first frame memory line shown at the top of the scrolling area.
+ *
+ * Moving the scroll start by N lines scrolls the whole scrolling area by N lines without rewriting any pixel,
+ * so only the lines that are newly exposed need to be drawn.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @param[in] Copy_Line The frame memory line to show first, counted from the start of the frame memory.
+ * @retval None
+ */
+void TFT_SetScrollStart(const TFT_Device_t *Copy_Device, u16 Copy_Line);
+
+/**
+ * @brief Checks whether the frame memory lines are the screen rows, top to bottom.
+ *
+ * It is the case when the row/column exchange and the row order are those of the natural orientation
+ * (rotation 0, with or without TFT_MIRROR_X). The scroll lines can then be used as screen Y coordinates.
+ *
+ * @param[in] Copy_Device Pointer to the display.
+ * @return 1 when frame memory line N is screen row N, 0 otherwise or when Copy_Device is NULL.
+ */
+u8 TFT_IsScrollAlongRows(const TFT_Device_t *Copy_Device);
+
+/** @} TFT_Device_Functions */
+
+#endif /**< __TFT_DEVICE_INTERFACE_H__ */
@@ -0,0 +1,29 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Device_private.h
+ * @brief This file contains the private definitions of the TFT display devices.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_DEVICE_PRIVATE_H__
+#define __TFT_DEVICE_PRIVATE_H__
+
+/**
+ * @brief MIPI DCS commands common to all the supported controllers.
+ */
+#define TFT_DCS_VSCRDEF         0x33    /**< Vertical scrolling definition */
+#define TFT_DCS_MADCTL          0x36    /**< Memory access control */
+#define TFT_DCS_VSCRSADD        0x37    /**< Vertical scrolling start address */
+
+/**
+ * @brief MADCTL bits toggled to rotate and mirror the display.
+ */
+#define TFT_MADCTL_MY           0x80    /**< Row address order */
+#define TFT_MADCTL_MX           0x40    /**< Column address order */
+#define TFT_MADCTL_MV           0x20    /**< Row/column exchange */
+
+#endif /**< __TFT_DEVICE_PRIVATE_H__ */
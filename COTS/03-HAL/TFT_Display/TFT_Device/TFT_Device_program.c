@@ -0,0 +1,302 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Device_program.c
+ * @brief This file contains the implementation of the functions shared by all the TFT display devices.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "DWT_interface.h"
+/**< HAL */
+#include "TFT_Device_interface.h"
+#include "TFT_Device_private.h"
+#include "TFT_Device_config.h"
+
+/**< 5-bit channel value to the RGB666 channel byte: ((v << 1) | (v >> 4)) << 2 */
+const u8 TFT_Rgb666From5Bit[32] =
+{
+    0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38,
+    0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78,
+    0x84, 0x8C, 0x94, 0x9C, 0xA4, 0xAC, 0xB4, 0xBC,
+    0xC4, 0xCC, 0xD4, 0xDC, 0xE4, 0xEC, 0xF4, 0xFC
+};
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void TFT_SendCommandSequence(const TFT_Device_t *Copy_Device, const u8 *Copy_Sequence)
+{
+    u8 Local_Command;
+    u8 Local_Count;
+    u16 Local_Delay;
+
+    if ((Copy_Device == NULL) || (Copy_Sequence == NULL))
+    {
+        return;
+    }
+
+    while (Copy_Sequence[1] != TFT_SEQ_END_MARKER)
+    {
+        Local_Command = Copy_Sequence[0];
+        Local_Count = Copy_Sequence[1];
+        Copy_Sequence += 2;
+
+        /**< The command and all its parameters in one go */
+        Copy_Device->Ops->WriteCommand(Copy_Device, Local_Command, Copy_Sequence, Local_Count & TFT_SEQ_COUNT_MASK);
+        Copy_Sequence += Local_Count & TFT_SEQ_COUNT_MASK;
+
+        if (Local_Count & TFT_SEQ_DELAY)
+        {
+            Local_Delay = ((u16)Copy_Sequence[0] << 8) | Copy_Sequence[1];
+            Copy_Sequence += 2;
+            DWT_DelayMs(Local_Delay);
+        }
+    }
+}
+
+void TFT_SetOrientation(TFT_Device_t *Copy_Device, TFT_Rotation_t Copy_Rotation, u8 Copy_Mirror)
+{
+    u8 Local_Madctl;
+
+    if (Copy_Device == NULL)
+    {
+        return;
+    }
+
+    Local_Madctl = Copy_Device->MadctlNatural;
+
+    /**< Rotate by flipping the address orders relative to the natural orientation */
+    switch (Copy_Rotation)
+    {
+    case TFT_ROTATION_0:
+        break;
+    case TFT_ROTATION_90:
+        Local_Madctl ^= TFT_MADCTL_MV | TFT_MADCTL_MX;
+        break;
+    case TFT_ROTATION_180:
+        Local_Madctl ^= TFT_MADCTL_MY | TFT_MADCTL_MX;
+        break;
+    case TFT_ROTATION_270:
+        Local_Madctl ^= TFT_MADCTL_MV | TFT_MADCTL_MY;
+        break;
+    default:
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    /**< With rows and columns exchanged, the screen X axis is the memory row axis */
+    if (Local_Madctl & TFT_MADCTL_MV)
+    {
+        if (Copy_Mirror & TFT_MIRROR_X)
+        {
+            Local_Madctl ^= TFT_MADCTL_MY;
+        }
+        if (Copy_Mirror & TFT_MIRROR_Y)
+        {
+            Local_Madctl ^= TFT_MADCTL_MX;
+        }
+    }
+    else
+    {
+        if (Copy_Mirror & TFT_MIRROR_X)
+        {
+            Local_Madctl ^= TFT_MADCTL_MX;
+        }
+        if (Copy_Mirror & TFT_MIRROR_Y)
+        {
+            Local_Madctl ^= TFT_MADCTL_MY;
+        }
+    }
+
+    Copy_Device->Ops->WriteCommand(Copy_Device, TFT_DCS_MADCTL, &Local_Madctl, 1);
+    Copy_Device->Madctl = Local_Madctl;
+
+    /**< Swap the drawing limits for the quarter turns */
+    if ((Copy_Rotation == TFT_ROTATION_90) || (Copy_Rotation == TFT_ROTATION_270))
+    {
+        Copy_Device->Width = Copy_Device->NativeHeight;
+        Copy_Device->Height = Copy_Device->NativeWidth;
+    }
+    else
+    {
+        Copy_Device->Width = Copy_Device->NativeWidth;
+        Copy_Device->Height = Copy_Device->NativeHeight;
+    }
+}
+
+u16 TFT_GetWidth(const TFT_Device_t *Copy_Device)
+{
+    if (Copy_Device == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return 0;
+    }
+
+    return Copy_Device->Width;
+}
+
+u16 TFT_GetHeight(const TFT_Device_t *Copy_Device)
+{
+    if (Copy_Device == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return 0;
+    }
+
+    return Copy_Device->Height;
+}
+
+void TFT_ClearScreen(const TFT_Device_t *Copy_Device)
+{
+    if (Copy_Device == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    /**< Fill the screen with the default background color */
+    TFT_FillRect(Copy_Device, 0, 0, Copy_Device->Width, Copy_Device->Height, TFT_DEFAULT_BACKGROUND_COLOR);
+}
+
+void TFT_DrawPixel(const TFT_Device_t *Copy_Device, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Color)
+{
+    /**< Ignore the pixels outside the screen */
+    if ((Copy_Device == NULL) || (Copy_XPosition >= Copy_Device->Width) || (Copy_YPosition >= Copy_Device->Height))
+    {
+        return;
+    }
+
+    Copy_Device->Ops->SetWindow(Copy_Device, Copy_XPosition, Copy_YPosition, Copy_XPosition, Copy_YPosition);
+    Copy_Device->Ops->PushPixels(Copy_Device, &Copy_Color, 1);
+}
+
+void TFT_FillRect(const TFT_Device_t *Copy_Device, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color)
+{
+    /**< Nothing to draw if the rectangle is empty or starts outside the screen */
+    if ((Copy_Device == NULL) || (Copy_Width == 0) || (Copy_Height == 0) || (Copy_XPosition >= Copy_Device->Width) || (Copy_YPosition >= Copy_Device->Height))
+    {
+        return;
+    }
+
+    /**< Clip the rectangle to the screen */
+    if (Copy_Width > (Copy_Device->Width - Copy_XPosition))
+    {
+        Copy_Width = Copy_Device->Width - Copy_XPosition;
+    }
+    if (Copy_Height > (Copy_Device->Height - Copy_YPosition))
+    {
+        Copy_Height = Copy_Device->Height - Copy_YPosition;
+    }
+
+    /**< One window, one burst of the same color */
+    Copy_Device->Ops->SetWindow(Copy_Device, Copy_XPosition, Copy_YPosition, Copy_XPosition + Copy_Width - 1, Copy_YPosition + Copy_Height - 1);
+    Copy_Device->Ops->Fill(Copy_Device, Copy_Color, (u32)Copy_Width * Copy_Height);
+}
+
+void TFT_DrawBitmap(const TFT_Device_t *Copy_Device, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Bitmap)
+{
+    u16 Local_VisibleWidth  = Copy_Width;
+    u16 Local_VisibleHeight = Copy_Height;
+    u16 Local_Row;
+
+    if ((Copy_Device == NULL) || (Copy_Bitmap == NULL) || (Copy_Width == 0) || (Copy_Height == 0) || (Copy_XPosition >= Copy_Device->Width) || (Copy_YPosition >= Copy_Device->Height))
+    {
+        return;
+    }
+
+    /**< Clip the bitmap to the screen */
+    if (Local_VisibleWidth > (Copy_Device->Width - Copy_XPosition))
+    {
+        Local_VisibleWidth = Copy_Device->Width - Copy_XPosition;
+    }
+    if (Local_VisibleHeight > (Copy_Device->Height - Copy_YPosition))
+    {
+        Local_VisibleHeight = Copy_Device->Height - Copy_YPosition;
+    }
+
+    Copy_Device->Ops->SetWindow(Copy_Device, Copy_XPosition, Copy_YPosition, Copy_XPosition + Local_VisibleWidth - 1, Copy_YPosition + Local_VisibleHeight - 1);
+
+    if (Local_VisibleWidth == Copy_Width)
+    {
+        /**< Rows are contiguous in memory: stream the whole bitmap at once */
+        Copy_Device->Ops->PushPixels(Copy_Device, Copy_Bitmap, (u32)Copy_Width * Local_VisibleHeight);
+    }
+    else
+    {
+        /**< The window wraps at its right edge, so only the visible part of each row is sent */
+        for (Local_Row = 0; Local_Row < Local_VisibleHeight; Local_Row++)
+        {
+            Copy_Device->Ops->PushPixels(Copy_Device, &Copy_Bitmap[(u32)Local_Row * Copy_Width], Local_VisibleWidth);
+        }
+    }
+}
+
+void TFT_DisplayImage(const TFT_Device_t *Copy_Device, const u16 *Copy_Image)
+{
+    if ((Copy_Device == NULL) || (Copy_Image == NULL))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    /**< Open a window covering the whole screen in the current orientation */
+    Copy_Device->Ops->SetWindow(Copy_Device, 0, 0, Copy_Device->Width - 1, Copy_Device->Height - 1);
+
+    /**< Stream the image pixels in scan order */
+    Copy_Device->Ops->PushPixels(Copy_Device, Copy_Image, (u32)Copy_Device->Width * Copy_Device->Height);
+}
+
+void TFT_SetScrollArea(const TFT_Device_t *Copy_Device, u16 Copy_TopFixedLines, u16 Copy_BottomFixedLines)
+{
+    u8  Local_Params[6];
+    u16 Local_ScrollLines;
+
+    if ((Copy_Device == NULL) || (((u32)Copy_TopFixedLines + Copy_BottomFixedLines) > Copy_Device->FrameMemoryLines))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    /**< The three areas must cover the whole frame memory */
+    Local_ScrollLines = Copy_Device->FrameMemoryLines - Copy_TopFixedLines - Copy_BottomFixedLines;
+
+    Local_Params[0] = (Copy_TopFixedLines >> 8) & 0xFF;     /**< Top fixed area, high byte */
+    Local_Params[1] = Copy_TopFixedLines & 0xFF;            /**< Top fixed area, low byte */
+    Local_Params[2] = (Local_ScrollLines >> 8) & 0xFF;      /**< Vertical scrolling area, high byte */
+    Local_Params[3] = Local_ScrollLines & 0xFF;             /**< Vertical scrolling area, low byte */
+    Local_Params[4] = (Copy_BottomFixedLines >> 8) & 0xFF;  /**< Bottom fixed area, high byte */
+    Local_Params[5] = Copy_BottomFixedLines & 0xFF;         /**< Bottom fixed area, low byte */
+
+    Copy_Device->Ops->WriteCommand(Copy_Device, TFT_DCS_VSCRDEF, Local_Params, 6);
+}
+
+void TFT_SetScrollStart(const TFT_Device_t *Copy_Device, u16 Copy_Line)
+{
+    u8 Local_Params[2];
+
+    if (Copy_Device == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    Local_Params[0] = (Copy_Line >> 8) & 0xFF;  /**< Scroll start address, high byte */
+    Local_Params[1] = Copy_Line & 0xFF;         /**< Scroll start address, low byte */
+
+    Copy_Device->Ops->WriteCommand(Copy_Device, TFT_DCS_VSCRSADD, Local_Params, 2);
+}
+
+u8 TFT_IsScrollAlongRows(const TFT_Device_t *Copy_Device)
+{
+    if (Copy_Device == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return 0;
+    }
+
+    return ((Copy_Device->Madctl ^ Copy_Device->MadctlNatural) & (TFT_MADCTL_MV | TFT_MADCTL_MY)) == 0;
+}
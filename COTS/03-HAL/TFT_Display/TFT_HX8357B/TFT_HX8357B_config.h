@@ -56,30 +56,32 @@
 #define TFT_DISPLAY_COLORS          _16BIT_PER_PIXEL
 
 /**
- * @brief Defines the default background color for the TFT display.
+ * @brief Defines the number of lines in the controller frame memory.
  *
- * This option should be set to the default background color used when clearing the display.
- * The color is represented in 16-bit RGB565 format.
- * For example, BLACK can be represented as 0x0000 (RGB565 value).
+ * The vertical scrolling definition (top fixed area + scroll area + bottom fixed area) must add up
+ * to this value. The HX8357B frame memory matches the 320x480 panel.
+ */
+#define TFT_FRAME_MEMORY_LINES      480
+
+/**
+ * @brief Defines the MADCTL value of the panel in its natural (0 degree) orientation.
+ *
+ * This option holds the panel specific MADCTL bits (address order and color order) for the mounting
+ * used as the reference orientation. Rotation and mirroring are applied on top of it by toggling
+ * the MY, MX and MV bits. The HX8357B modules use BGR color order (0x08) with the horizontal flip bit (0x02) set.
+ */
+#define TFT_MADCTL_NATURAL          0x0A
+
+/**
+ * @brief Defines the orientation applied by TFT_HX8357B_Init().
  *
- * User options for this macro include:
- * - COLOR_BLACK       0x0000   Black Color (RGB565)
- * - COLOR_WHITE       0xFFFF   White Color (RGB565)
- * - COLOR_RED         0xF800   Red Color (RGB565)
- * - COLOR_GREEN       0x07E0   Green Color (RGB565)
- * - COLOR_BLUE        0x001F   Blue Color (RGB565)
- * - COLOR_CYAN        0x07FF   Cyan Color (RGB565)
- * - COLOR_MAGENTA     0xF81F   Magenta Color (RGB565)
- * - COLOR_YELLOW      0xFFE0   Yellow Color (RGB565)
- * - COLOR_ORANGE      0xFD20   Orange Color (RGB565)
- * - COLOR_PURPLE      0x8010   Purple Color (RGB565)
- * - COLOR_PINK        0xF81F   Pink Color (RGB565)
- * - COLOR_LIME        0x07E0   Lime Color (RGB565)
- * - COLOR_TEAL        0x0410   Teal Color (RGB565)
- * - COLOR_VIOLET      0x801F   Violet Color (RGB565)
- * - COLOR_BROWN       0xA145   Brown Color (RGB565)
+ * Available options:
+ * - @ref TFT_ROTATION_0: Natural orientation, TFT_DISPLAY_WIDTH x TFT_DISPLAY_HEIGHT.
+ * - @ref TFT_ROTATION_90: Rotated 90 degrees clockwise, width and height swapped.
+ * - @ref TFT_ROTATION_180: Rotated 180 degrees.
+ * - @ref TFT_ROTATION_270: Rotated 270 degrees clockwise, width and height swapped.
  */
-#define TFT_DEFAULT_BACKGROUND_COLOR    COLOR_BLACK
+#define TFT_DEFAULT_ROTATION        TFT_ROTATION_0
 
 ///**
 // * @brief Structure representing the font used for rendering text on the TFT display.
@@ -105,8 +107,11 @@
  * @brief Defines the communication interface used to communicate with the TFT display.
  *
  * This option should be set to the communication interface used to communicate with the TFT display.
- * For example, if the display uses SPI for communication, set TFT_COMM_INTERFACE to `TFT_COMM_INTERFACE_SPI`.
- * If the display uses I2C, set `TFT_COMM_INTERFACE` to TFT_COMM_INTERFACE_I2C.
+ *
+ * Available options:
+ * - @ref TFT_COMM_INTERFACE_SPI: 4-wire SPI, uses TFT_SpiBus of the configuration.
+ * - @ref TFT_COMM_INTERFACE_8080: 8/16-bit 8080 parallel bus, uses TFT_Bus of the configuration.
+ *   A full 320x480 frame takes about a tenth of the SPI time.
  */
 #define TFT_COMM_INTERFACE          TFT_COMM_INTERFACE_SPI
 
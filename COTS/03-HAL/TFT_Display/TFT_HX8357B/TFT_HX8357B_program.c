@@ -28,14 +28,52 @@
 /**<=========================================================================================*/
 #include "GPIO_interface.h"
 #include "SPI_interface.h"
-#include "STK_interface.h"
 
 /**<========================================================================================*/
 /*******************************************< HAL *******************************************/
 /**<========================================================================================*/
+#include "TFT_Device_interface.h"
+#include "TFT_Spi_interface.h"
+#include "TFT_Parallel_interface.h"
 #include "TFT_HX8357B_interface.h"
-#include "TFT_HX8357B_private.h"
 #include "TFT_HX8357B_config.h"
+#include "TFT_HX8357B_private.h"
+
+#if (TFT_DISPLAY_COLORS != _3BIT_PER_PIXEL) && (TFT_DISPLAY_COLORS != _16BIT_PER_PIXEL) && (TFT_DISPLAY_COLORS != _18BIT_PER_PIXEL)
+#error "Wrong TFT_DISPLAY_COLORS configuration option"
+#endif
+
+#if (TFT_COMM_INTERFACE != TFT_COMM_INTERFACE_SPI) && (TFT_COMM_INTERFACE != TFT_COMM_INTERFACE_8080)
+#error "Wrong TFT_COMM_INTERFACE configuration option"
+#endif
+
+/**< Low-level operations bound to the devices driven by this driver */
+static const TFT_DeviceOps_t TFT_HX8357B_Ops =
+{
+    TFT_SetWindow,
+    TFT_WritePixels,
+    TFT_WriteColor,
+    TFT_WriteCommand
+};
+
+/**< Controller initialization sequence, see TFT_SendCommandSequence() */
+static const u8 TFT_InitSequence[] =
+{
+    0x11, 0 | TFT_SEQ_DELAY, TFT_SEQ_MS(20),                        /**< Exit sleep mode */
+    0xD0, 3, 0x07, 0x42, 0x18,                                      /**< Power setting */
+    0xD1, 3, 0x00, 0x07, 0x10,                                      /**< VCOM setting */
+    0xD2, 2, 0x01, 0x02,                                            /**< Power setting for normal mode */
+    0xC0, 5, 0x10, 0x3B, 0x00, 0x02, 0x11,                          /**< Panel driving configuration */
+    0xC5, 1, 0x08,                                                  /**< Frame rate control */
+    0xC8, 12, 0x00, 0x32, 0x36, 0x45, 0x06, 0x16,                   /**< Gamma setting */
+              0x37, 0x75, 0x77, 0x54, 0x0C, 0x00,
+    0x36, 1, TFT_MADCTL_NATURAL,                                    /**< Address mode */
+    0x3A, 1, TFT_DISPLAY_COLORS,                                    /**< Pixel format */
+    0x2A, 4, 0x00, 0x00, 0x01, 0x3F,                                /**< Column address */
+    0x2B, 4 | TFT_SEQ_DELAY, 0x00, 0x00, 0x01, 0xDF, TFT_SEQ_MS(120), /**< Page address */
+    0x29, 0 | TFT_SEQ_DELAY, TFT_SEQ_MS(25),                        /**< Turn on display */
+    TFT_SEQ_END
+};
 
 /**<=============================================================================================================*/
 /*******************************************< Functions Implementation *******************************************/
@@ -46,137 +84,47 @@
  * @{
  */
 
-void TFT_Init(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral)
-{
-    /**< Set the Reset (RES) pin to high logic level to release reset signal */
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_RESPin.TFT_Port, Copy_TftDisplay->TFT_RESPin.TFT_Pin, GPIO_HIGH);
-    
-    /**< Wait for a specified delay before proceeding */
-    STK_SetDelay(50);
-    
-    /**< Set the Reset (RST) pin to low logic level to assert reset signal */
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_RESPin.TFT_Port, Copy_TftDisplay->TFT_RESPin.TFT_Pin, GPIO_LOW);
-    
-    /**< Wait for a short delay */
-    STK_SetDelay(10);
-    
-    /**< Set the Reset (RES) pin to high logic level to release reset signal */
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_RESPin.TFT_Port, Copy_TftDisplay->TFT_RESPin.TFT_Pin, GPIO_HIGH);
-    
-    /**< Wait for a specified delay before proceeding */
-    STK_SetDelay(10);
-    
-    TFT_InitController(Copy_TftDisplay, Copy_SpiPeripheral);
-}
-
-void TFT_ClearScreen(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral)
+Std_ReturnType TFT_HX8357B_Init(TFT_Device_t *Copy_Device, const TFT_HX8357B_Config_t *Copy_TftDisplay)
 {
-    /**< Set the X and Y addresses */
-    TFT_SetXYAddress(Copy_TftDisplay, Copy_SpiPeripheral, 0, 0);
-
-    /**< Send the command to write data to the RAM */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, TFT_RAMWR);
-
-    /**< Fill the screen with the default background color */
-    for (u32 i = 0; i < TFT_DISPLAY_WIDTH * TFT_DISPLAY_HEIGHT; i++)
+    if ((Copy_Device == NULL) || (Copy_TftDisplay == NULL))
     {
-        TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, (TFT_DEFAULT_BACKGROUND_COLOR >> 8) & 0xFF); /**< High byte of color */
-        TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, TFT_DEFAULT_BACKGROUND_COLOR & 0xFF);        /**< Low byte of color */
+        return E_NOT_OK;
     }
-}
 
-void TFT_DrawLine(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 x1, u16 y1, u16 x2, u16 y2, u16 color)
-{
-    int Local_dx = abs(x2 - x1);            /**< Calculate the absolute difference in X coordinates. */
-    int Local_sx = x1 < x2 ? 1 : -1;        /**< Determine the X direction (positive or negative). */
-    int Local_dy = -abs(y2 - y1);           /**< Calculate the negative absolute difference in Y coordinates. */
-    int Local_sy = y1 < y2 ? 1 : -1;        /**< Determine the Y direction (positive or negative). */
-    int Local_err = Local_dx + Local_dy;    /**< Initialize the error term for line drawing algorithm. */
-    int Local_e2;                           /**< Initialize a variable for tracking another error term. */
-
-    while (1)
+#if (TFT_COMM_INTERFACE == TFT_COMM_INTERFACE_8080) && (TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL)
+    /**< The 18-bit pixels are sent in three cycles of 8 bits, there is no transfer for them on a 16-bit bus */
+    if (Copy_TftDisplay->TFT_Bus.TFT_BusWidth != TFT_BUS_8BIT)
     {
-        /**< Draw a pixel at the current position */ 
-        TFT_DrawPixel(Copy_TftDisplay, Copy_SpiPeripheral, x1, y1, color);
-
-        /**< Check if we've reached the end point */ 
-        if (x1 == x2 && y1 == y2)
-            break;
-
-        Local_e2 = 2 * Local_err;
-
-        /**< Calculate the next position */ 
-        if (Local_e2 >= Local_dy)
-        {
-            Local_err += Local_dy;
-            x1 += Local_sx;
-        }
-
-        if (Local_e2 <= Local_dx)
-        {
-            Local_err += Local_dx;
-            y1 += Local_sy;
-        }
+        return E_NOT_OK;
     }
+#endif
+
+    /**< Bind the driver to the device */
+    Copy_Device->Ops = &TFT_HX8357B_Ops;
+    Copy_Device->Config = Copy_TftDisplay;
+    Copy_Device->NativeWidth = TFT_DISPLAY_WIDTH;
+    Copy_Device->NativeHeight = TFT_DISPLAY_HEIGHT;
+    Copy_Device->FrameMemoryLines = TFT_FRAME_MEMORY_LINES;
+    Copy_Device->MadctlNatural = TFT_MADCTL_NATURAL;
+    Copy_Device->Width = TFT_DISPLAY_WIDTH;
+    Copy_Device->Height = TFT_DISPLAY_HEIGHT;
+
+    /**< Hardware reset */
+#if TFT_COMM_INTERFACE == TFT_COMM_INTERFACE_SPI
+    TFT_SpiReset(&Copy_TftDisplay->TFT_SpiBus);
+#else
+    TFT_ParallelReset(&Copy_TftDisplay->TFT_Bus);
+#endif
+
+    /**< Configure the controller */
+    TFT_SendCommandSequence(Copy_Device, TFT_InitSequence);
+
+    /**< Apply the configured mounting orientation */
+    TFT_SetOrientation(Copy_Device, TFT_DEFAULT_ROTATION, TFT_MIRROR_NONE);
+
+    return E_OK;
 }
 
-void TFT_DisplayImage(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u16 *Copy_Image)
-{
-    /*******************************************< Set the X and Y addresses for drawing pixels *******************************************/ 
-	
-    /**< Calculate the high and low bytes of the end X coordinates */
-    u8 xEndHigh = ((TFT_DISPLAY_WIDTH-1) >> 8) & 0xFF;
-    u8 xEndLow = (TFT_DISPLAY_HEIGHT-1) & 0xFF;
-
-	/**< Send the commands to set the X addresses */
-	TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, TFT_CASET);      /**< Send column address command */
-	TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0);                 /**< Send high byte of start X address */
-	TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0);                 /**< Send low byte of start X address */
-	TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, xEndHigh);          /**< Send high byte of end X address */
-	TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, xEndLow);           /**< Send low byte of end X address */
-
-    /**< Calculate the high and low bytes of the end Y coordinates */
-    u8 yEndHigh = ((TFT_DISPLAY_HEIGHT-1) >> 8) & 0xFF;
-    u8 yEndLow = (TFT_DISPLAY_HEIGHT-1) & 0xFF;
-
-	/**< Send the commands to set the Y addresses */
-	TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, TFT_PASET); /**< Send row address command */
-	TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0);            /**< Send high byte of start Y address */
-	TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0);            /**< Send low byte of start Y address */
-	TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, yEndHigh);     /**< Send high byte of end Y address */       
-	TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, yEndLow);      /**< Send high byte of end Y address */
-
-
-    /*******************************************< Send the command to write data to the RAM *******************************************/
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, TFT_RAMWR);
-
-    /*******************************************< Loop through the image pixels *******************************************/ 
-    for (u16 Local_Counter = 0; Local_Counter < TFT_DISPLAY_HEIGHT * TFT_DISPLAY_WIDTH; Local_Counter++)
-    {
-		/**< Send the pixel color data */
-		TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, (Copy_Image[Local_Counter] >> 8) & 0xFF); /**< High byte of color */
-		TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, Copy_Image[Local_Counter] & 0xFF);        /**< Low byte of color */
-    }
-}
-
-/**
- * @brief Displays text on the TFT screen.
- *
- * This function displays text at the specified (x, y) coordinates with the given color.
- *
- * @param[in] x The X-coordinate where the text will be displayed.
- * @param[in] y The Y-coordinate where the text will be displayed.
- * @param[in] text Pointer to the text string to be displayed.
- * @param[in] font The font size and style to use for rendering the text.
- * @param[in] color The color of the text in 16-bit RGB565 format.
- * @retval None
- */
-//void TFT_voidDisplayText(u16 x, u16 y, const char* text, const Font_t* font, u16 color)
-//{
-//    /**< Implement the TFT text display function */
-//
-//}
-
 /**
  * @} TFT_Public_Functions
  */
@@ -186,188 +134,75 @@ void TFT_DisplayImage(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiP
  * @{
  */
 
-static void TFT_SendCommand(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Command)
+static void TFT_SetWindow(const TFT_Device_t *Copy_Device, u16 Copy_XStart, u16 Copy_YStart, u16 Copy_XEnd, u16 Copy_YEnd)
 {
-    /**< Temp variable to receive the data in */
-    u8 Local_u8ReceivedData = 0;
-
-    /**<  Set CS (Chip Select) pin low to select the TFT display for communication */
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin,GPIO_LOW); 
-
-    /**< Set DC (Data/Command Control) pin low to indicate command mode */ 
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_DCPin.TFT_Port, Copy_TftDisplay->TFT_DCPin.TFT_Pin,GPIO_LOW); 
-
-    /**< Perform SPI data transfer to send the command byte */ 
-    SPI_voidTransfer(Copy_SpiPeripheral, &Copy_Command, &Local_u8ReceivedData, 1); 
-
-    /**< Set CS pin high to release the TFT display */ 
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin,GPIO_HIGH); 
-}
-
-static void TFT_SendData(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Data)
-{
-    /**< Temp variable to receive the data in */
-    u8 Local_u8ReceivedData = 0;
-
-    /**<  Set CS (Chip Select) pin low to select the TFT display for communication */
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin,GPIO_LOW); 
-
-    /**< Set DC (Data/Command Control) pin low to indicate command mode */ 
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_DCPin.TFT_Port, Copy_TftDisplay->TFT_DCPin.TFT_Pin,GPIO_HIGH); 
-
-    /**< Perform SPI data transfer to send the command byte */ 
-    SPI_voidTransfer(Copy_SpiPeripheral, &Copy_Data, &Local_u8ReceivedData, 1); 
-
-    /**< Set CS pin high to release the TFT display */ 
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin,GPIO_HIGH); 
-}
-
-static void TFT_DrawPixel(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 color) 
-{
-    /**< Set the X and Y addresses */
-    TFT_SetXYAddress(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition);
-
-    /**< Send the command to write data to the RAM */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, TFT_RAMWR);
-
-    /**< Send the pixel color data */
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, (color >> 8) & 0xFF); /**< High byte of color */ 
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, color & 0xFF);        /**< Low byte of color */
-}
-
-static void TFT_SetXAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition)
- {
-    /**< Calculate the high and low bytes of the X coordinate */ 
-    u8 xHigh = (Copy_XPosition >> 8) & 0xFF;
-    u8 xLow = Copy_XPosition & 0xFF;
-
-    /**< Send the commands to set the X address */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, TFT_CASET);  /**< Send column address command */ 
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, xHigh);         /**< Send high byte of X address */ 
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, xLow);          /**< Send low byte of X address */
+    u8 Local_Params[4];
+
+    /**< Column range */
+    Local_Params[0] = (Copy_XStart >> 8) & 0xFF;
+    Local_Params[1] = Copy_XStart & 0xFF;
+    Local_Params[2] = (Copy_XEnd >> 8) & 0xFF;
+    Local_Params[3] = Copy_XEnd & 0xFF;
+    TFT_WriteCommand(Copy_Device, TFT_CASET, Local_Params, 4);
+
+    /**< Row range */
+    Local_Params[0] = (Copy_YStart >> 8) & 0xFF;
+    Local_Params[1] = Copy_YStart & 0xFF;
+    Local_Params[2] = (Copy_YEnd >> 8) & 0xFF;
+    Local_Params[3] = Copy_YEnd & 0xFF;
+    TFT_WriteCommand(Copy_Device, TFT_PASET, Local_Params, 4);
+
+    /**< The pixels that follow go to the window */
+    TFT_WriteCommand(Copy_Device, TFT_RAMWR, NULL, 0);
 }
 
-static void TFT_SetYAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_YPosition) 
+static void TFT_WritePixels(const TFT_Device_t *Copy_Device, const u16 *Copy_Pixels, u32 Copy_Count)
 {
-    // Calculate the high and low bytes of the Y coordinate
-    u8 yHigh = (Copy_YPosition >> 8) & 0xFF;
-    u8 yLow = Copy_YPosition & 0xFF;
-
-    // Send the commands to set the Y address
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, TFT_PASET); /**< Send row address command */ 
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, yHigh);        /**< Send high byte of Y address */
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, yLow);         /**< Send low byte of Y address */ 
+    const TFT_HX8357B_Config_t *Local_TftDisplay = Copy_Device->Config;
+
+#if TFT_COMM_INTERFACE == TFT_COMM_INTERFACE_SPI
+#if TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL
+    TFT_SpiWritePixels666(&Local_TftDisplay->TFT_SpiBus, Copy_Pixels, Copy_Count);
+#else
+    TFT_SpiWritePixels(&Local_TftDisplay->TFT_SpiBus, Copy_Pixels, Copy_Count);
+#endif
+#else
+#if TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL
+    TFT_ParallelWritePixels666(&Local_TftDisplay->TFT_Bus, Copy_Pixels, Copy_Count);
+#else
+    TFT_ParallelWritePixels(&Local_TftDisplay->TFT_Bus, Copy_Pixels, Copy_Count);
+#endif
+#endif
 }
 
-static void TFT_SetXYAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition) 
+static void TFT_WriteColor(const TFT_Device_t *Copy_Device, u16 Copy_Color, u32 Copy_Count)
 {
-    /**< Calculate the high and low bytes of the X coordinates */ 
-    u8 xHigh = (Copy_XPosition >> 8) & 0xFF;
-    u8 xLow = Copy_XPosition & 0xFF;
-
-    /**< Calculate the high and low bytes of the Y coordinates */ 
-    u8 yHigh = (Copy_YPosition >> 8) & 0xFF;
-    u8 yLow = Copy_YPosition & 0xFF;
-
-    /**< Send the commands to set the X addresses */ 
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, TFT_CASET); /**< Send column address command */   
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, xHigh);         /**< Send high byte of X address */   
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, xLow);          /**< Send low byte of X address */
-
-    /**< Send the commands to set the Y addresses */ 
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, TFT_PASET); /**< Send row address command */
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, yHigh);        /**< Send high byte of Y address */
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, yLow);         /**< Send low byte of Y address */
+    const TFT_HX8357B_Config_t *Local_TftDisplay = Copy_Device->Config;
+
+#if TFT_COMM_INTERFACE == TFT_COMM_INTERFACE_SPI
+#if TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL
+    TFT_SpiWriteColor666(&Local_TftDisplay->TFT_SpiBus, Copy_Color, Copy_Count);
+#else
+    TFT_SpiWriteColor(&Local_TftDisplay->TFT_SpiBus, Copy_Color, Copy_Count);
+#endif
+#else
+#if TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL
+    TFT_ParallelWriteColor666(&Local_TftDisplay->TFT_Bus, Copy_Color, Copy_Count);
+#else
+    TFT_ParallelWriteColor(&Local_TftDisplay->TFT_Bus, Copy_Color, Copy_Count);
+#endif
+#endif
 }
 
-static void TFT_InitController(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral)
+static void TFT_WriteCommand(const TFT_Device_t *Copy_Device, u8 Copy_Command, const u8 *Copy_Params, u8 Copy_ParamCount)
 {
-    /**<==============================================================================================================*/
-    /*******************************************< Configure ST7735S display *******************************************/ 
-    /**<==============================================================================================================*/   
-    /**< Send command to exit sleep mode */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x11);
-    STK_SetDelay(20);
-
-    /**< Send command to set power setting */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xD0);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x07);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x42);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x18);
-
-    /**< Send command to set VCOM setting */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xD1);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x07);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x10);
-
-    /**< Send command to set display frame memory write mode */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xD2);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x01);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x02);
-
-    /**< Send command to set panel driving configuration */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xC0);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x10);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x3B);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x02);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x11);
-
-    /**< Send command to configure display brightness */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xC5);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x08);
-
-    /**< Send command to configure frame rate control */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xC8);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x32);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x36);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x45);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x06);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x16);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x37);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x75);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x77);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x54);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x0C);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-
-    /**< Send command to set address mode */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x36);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x0a);
-
-    /**< Send command to set pixel format */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x3A);
-    #if (TFT_DISPLAY_COLORS == _3BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _16BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL)
-        TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, TFT_DISPLAY_COLORS);
-    #else
-        TFT_SendCommand(Copy_TftDisplay, 0x21);
-    #endif
-
-    /**< Send command to set column address */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x2A);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x01);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x3F);
-
-    /**< Send command to set page address */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x2B);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x01);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0xDF);
-
-    /**< Delay */
-    STK_SetDelay(120);
+    const TFT_HX8357B_Config_t *Local_TftDisplay = Copy_Device->Config;
 
-    /**< Send command to turn on display */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x29);
-    STK_SetDelay(25);
-    /**<=========================================================================================================================*/
-    /*******************************************< End of ST7735S display configuration *******************************************/
-    /**<=========================================================================================================================*/
+#if TFT_COMM_INTERFACE == TFT_COMM_INTERFACE_SPI
+    TFT_SpiWriteCommand(&Local_TftDisplay->TFT_SpiBus, Copy_Command, Copy_Params, Copy_ParamCount);
+#else
+    TFT_ParallelWriteCommand(&Local_TftDisplay->TFT_Bus, Copy_Command, Copy_Params, Copy_ParamCount);
+#endif
 }
 
 /**
@@ -54,13 +54,32 @@
 #define TFT_DISPLAY_COLORS          _16BIT_PER_PIXEL
 
 /**
- * @brief Defines the default background color for the TFT display.
+ * @brief Defines the number of lines in the controller frame memory.
  *
- * This option should be set to the default background color used when clearing the display.
- * The color is represented in 16-bit RGB565 format.
- * For example, BLACK can be represented as 0x0000 (RGB565 value).
+ * The vertical scrolling definition (top fixed area + scroll area + bottom fixed area) must add up
+ * to this value. The ILI9481 frame memory matches the 320x480 panel.
  */
-#define TFT_DEFAULT_BACKGROUND_COLOR    0x0000
+#define TFT_FRAME_MEMORY_LINES      480
+
+/**
+ * @brief Defines the MADCTL value of the panel in its natural (0 degree) orientation.
+ *
+ * This option holds the panel specific MADCTL bits (address order and color order) for the mounting
+ * used as the reference orientation. Rotation and mirroring are applied on top of it by toggling
+ * the MY, MX and MV bits. The ILI9481 modules use BGR color order (0x08) with the horizontal flip bit (0x02) set.
+ */
+#define TFT_MADCTL_NATURAL          0x0A
+
+/**
+ * @brief Defines the orientation applied by TFT_ILI9481_Init().
+ *
+ * Available options:
+ * - @ref TFT_ROTATION_0: Natural orientation, TFT_DISPLAY_WIDTH x TFT_DISPLAY_HEIGHT.
+ * - @ref TFT_ROTATION_90: Rotated 90 degrees clockwise, width and height swapped.
+ * - @ref TFT_ROTATION_180: Rotated 180 degrees.
+ * - @ref TFT_ROTATION_270: Rotated 270 degrees clockwise, width and height swapped.
+ */
+#define TFT_DEFAULT_ROTATION        TFT_ROTATION_0
 
 ///**
 // * @brief Structure representing the font used for rendering text on the TFT display.
@@ -82,15 +101,6 @@
 // */
 //extern const Font_t TFT_DEFAULT_FONT;
 
-/**
- * @brief Defines the communication interface used to communicate with the TFT display.
- *
- * This option should be set to the communication interface used to communicate with the TFT display.
- * For example, if the display uses SPI for communication, set TFT_COMM_INTERFACE to `TFT_COMM_INTERFACE_SPI`.
- * If the display uses I2C, set `TFT_COMM_INTERFACE` to TFT_COMM_INTERFACE_I2C.
- */
-#define TFT_COMM_INTERFACE          TFT_COMM_INTERFACE_SPI
-
 /** @} TFT_Configuration_Options */
 
 #endif /**< __TFT_ILI9481_DISPLAYS_CONFIG_H__ */
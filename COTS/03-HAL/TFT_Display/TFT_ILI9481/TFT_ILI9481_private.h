@@ -133,86 +133,43 @@
  */
 
 /**
- * @brief Internal function to send commands to the TFT display controller.
+ * @brief Device operation: open an address window and start a memory write.
  *
- * This function is used internally to send commands to the TFT display controller
- * using the specified communication interface.
- *
- * @param command The command byte to be sent.
- */
-static void TFT_SendCommand(const TFT_Config_t *Copy_psTftDisplay, const SPI_t *Copy_psTheSpiTftUsed, u8 Copy_Command);
-
-/**
- * @brief Send data to the TFT display using SPI communication.
- *
- * This function sends a single data byte to the TFT display using the specified SPI peripheral.
- * It sets the RS (Register Select) pin to high to indicate data mode, selects the TFT display by
- * setting the CS (Chip Select) pin low, performs an SPI data transfer to send the data byte, and
- * then releases the display by setting the CS pin high again.
- *
- * @param[in] Copy_Spi The SPI peripheral to be used for communication.
- * @param[in] Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param[in] Copy_Data The data byte to be sent to the TFT display.
- *
- * @return None.
- *
- * @note Make sure to properly configure the TFT display and GPIO functions before calling this function.
- *
- * @note Example Usage:
- * @code
- * /**< Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /**< ... other configuration settings ...
- * };
- *
- * /**< Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /**< Send data (e.g., 0x55) to the TFT display
- * TFT_SendData(spiPeripheral, &tftConfig, 0x55);
- * @endcode
+ * @param Copy_Device Pointer to the display.
+ * @param Copy_XStart The first column of the window.
+ * @param Copy_YStart The first row of the window.
+ * @param Copy_XEnd The last column of the window (inclusive).
+ * @param Copy_YEnd The last row of the window (inclusive).
  */
-static void TFT_SendData(const TFT_Config_t *Copy_psTftDisplay, const SPI_t *Copy_psTheSpiTftUsed, u8 Copy_Data);
+static void TFT_SetWindow(const TFT_Device_t *Copy_Device, u16 Copy_XStart, u16 Copy_YStart, u16 Copy_XEnd, u16 Copy_YEnd);
 
 /**
- * @brief Internal function to initialize the TFT display controller.
+ * @brief Device operation: stream an array of pixels into the open window.
  *
- * This function is used internally to initialize the TFT display controller
- * based on the configuration settings provided in the TFT_DisplayController_t structure.
+ * @param Copy_Device Pointer to the display.
+ * @param Copy_Pixels Pointer to the pixels in 16-bit RGB565 format.
+ * @param Copy_Count The number of pixels to write.
  */
-static void TFT_InitController(const TFT_Config_t *Copy_psTftDisplay, SPI_t *Copy_psTheSpiTftUsed);
+static void TFT_WritePixels(const TFT_Device_t *Copy_Device, const u16 *Copy_Pixels, u32 Copy_Count);
 
 /**
- * @brief Internal function to draw a pixel on the TFT display.
+ * @brief Device operation: stream the same color a number of times into the open window.
  *
- * This function is used internally to draw a pixel on the TFT display at the specified
- * coordinates using the specified color.
- *
- * @param x The x-coordinate of the pixel.
- * @param y The y-coordinate of the pixel.
- * @param color The color of the pixel in 16-bit RGB565 format.
+ * @param Copy_Device Pointer to the display.
+ * @param Copy_Color The color in 16-bit RGB565 format.
+ * @param Copy_Count The number of pixels to write.
  */
-static void TFT_DrawPixel(u16 x, u16 y, u16 color);
+static void TFT_WriteColor(const TFT_Device_t *Copy_Device, u16 Copy_Color, u32 Copy_Count);
 
 /**
- * @brief Internal function to draw a character on the TFT display.
- *
- * This function is used internally to draw a character on the TFT display at the specified
- * coordinates using the specified font and color.
+ * @brief Device operation: send a command followed by its parameters.
  *
- * @param x The x-coordinate of the character.
- * @param y The y-coordinate of the character.
- * @param character The character to be drawn.
- * @param font Pointer to the font data structure.
- * @param textColor The color of the character in 16-bit RGB565 format.
- * @param backgroundColor The background color of the character in 16-bit RGB565 format.
+ * @param Copy_Device Pointer to the display.
+ * @param Copy_Command The command byte.
+ * @param Copy_Params Pointer to the parameter bytes.
+ * @param Copy_ParamCount The number of parameter bytes.
  */
-//static void TFT_DrawCharacter(u16 x, u16 y, char character, const Font_t *font, u16 textColor, u16 backgroundColor);
-
-/* Add more internal functions and private declarations as needed */
+static void TFT_WriteCommand(const TFT_Device_t *Copy_Device, u8 Copy_Command, const u8 *Copy_Params, u8 Copy_ParamCount);
 
 /** @} TFT_Private_Functions */
 
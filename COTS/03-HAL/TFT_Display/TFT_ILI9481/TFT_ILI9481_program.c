@@ -15,259 +15,164 @@
  * @see TFT_Displays_interface.h for the public interface and function descriptions.
  */
 
-/**< LIB */
+/**<========================================================================================*/
+/*******************************************< LIB *******************************************/
+/**<========================================================================================*/
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
 
-/**< MCAL */
+/**<=========================================================================================*/
+/*******************************************< MCAL *******************************************/
+/**<=========================================================================================*/
 #include "GPIO_interface.h"
-#include "SPI_interface.h"
-#include "STK_interface.h"
 
-/**< HAL */
-#include "TFT_ILI9481_config.h"
+/**<========================================================================================*/
+/*******************************************< HAL *******************************************/
+/**<========================================================================================*/
+#include "TFT_Device_interface.h"
+#include "TFT_Parallel_interface.h"
 #include "TFT_ILI9481_interface.h"
 #include "TFT_ILI9481_private.h"
+#include "TFT_ILI9481_config.h"
 
+#if (TFT_DISPLAY_COLORS != _3BIT_PER_PIXEL) && (TFT_DISPLAY_COLORS != _16BIT_PER_PIXEL) && (TFT_DISPLAY_COLORS != _18BIT_PER_PIXEL)
+#error "Wrong TFT_DISPLAY_COLORS configuration option"
+#endif
 
-
-void TFT_Init(const TFT_Config_t *Copy_psTftDisplay, SPI_t Copy_psTheSpiTftUsed)
+/**< Low-level operations bound to the devices driven by this driver */
+static const TFT_DeviceOps_t TFT_ILI9481_Ops =
 {
-    /**< Set the Reset (RST) pin to high logic level to release reset signal */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RstPin, GPIO_HIGH);
-    
-    /**< Wait for a specified delay before proceeding */
-    STK_SetDelay(5);
-    
-    /**< Set the Reset (RST) pin to low logic level to assert reset signal */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RstPin, GPIO_LOW);
-    
-    /**< Wait for a short delay */
-    STK_SetDelay(15);
-    
-    /**< Set the Reset (RST) pin to high logic level to release reset signal */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RstPin, GPIO_HIGH);
-    
-    /**< Wait for a specified delay before proceeding */
-    STK_SetDelay(15);
-    
-    TFT_InitController(Copy_psTftDisplay, Copy_psTheSpiTftUsed);
-}
-
-/**
- * @brief Clears the display screen.
- *
- * This function clears the entire display screen and sets all pixels to the background color.
- *
- * @param None
- * @retval None
- */
-void TFT_ClearScreen(void)
-{
-    /**< Implement the TFT display screen clearing */
-    
-}
-
-/**
- * @brief Draws a pixel at the specified coordinates with the given color.
- *
- * This function draws a single pixel at the specified (x, y) coordinates with the specified color.
- *
- * @param[in] x The X-coordinate of the pixel.
- * @param[in] y The Y-coordinate of the pixel.
- * @param[in] color The color of the pixel in 16-bit RGB565 format.
- * @retval None
- */
-void TFT_DrawPixel(u16 x, u16 y, u16 color)
+    TFT_SetWindow,
+    TFT_WritePixels,
+    TFT_WriteColor,
+    TFT_WriteCommand
+};
+
+/**< Controller initialization sequence, see TFT_SendCommandSequence() */
+static const u8 TFT_InitSequence[] =
 {
-    /* Implement the TFT pixel drawing function */
-    
-}
+    TFT_EXIT_SLEEP_MODE, 0 | TFT_SEQ_DELAY, TFT_SEQ_MS(20),
+    TFT_POWER_SETTING, 3, 0x07, 0x42, 0x18,
+    TFT_VCOM_CONTROL, 3, 0x00, 0x07, 0x10,
+    TFT_POWER_SETTING_NORMAL, 2, 0x01, 0x02,
+    TFT_PANEL_DRIVING_SETTING, 5, 0x10, 0x3B, 0x00, 0x02, 0x11,
+    TFT_FRAME_RATE_INVERSION, 1, 0x03,
+    TFT_GAMMA_SETTING, 12, 0x00, 0x32, 0x36, 0x45, 0x06, 0x16,
+                           0x37, 0x75, 0x77, 0x54, 0x0C, 0x00,
+    TFT_SET_ADDRESS_MODE, 1, TFT_MADCTL_NATURAL,
+    TFT_SET_PIXEL_FORMAT, 1, TFT_DISPLAY_COLORS,
+    TFT_SET_COLUMN_ADDRESS, 4, 0x00, 0x00, 0x01, 0x3F,
+    TFT_SET_PAGE_ADDRESS, 4 | TFT_SEQ_DELAY, 0x00, 0x00, 0x01, 0xDF, TFT_SEQ_MS(120),
+    TFT_SET_DISPLAY_ON, 0,
+    TFT_SEQ_END
+};
+
+/**<=============================================================================================================*/
+/*******************************************< Functions Implementation *******************************************/
+/**<=============================================================================================================*/
 
 /**
- * @brief Draws a line between two points with the given color.
- *
- * This function draws a line between the specified starting point (x1, y1) and
- * the ending point (x2, y2) with the specified color.
- *
- * @param[in] x1 The X-coordinate of the starting point.
- * @param[in] y1 The Y-coordinate of the starting point.
- * @param[in] x2 The X-coordinate of the ending point.
- * @param[in] y2 The Y-coordinate of the ending point.
- * @param[in] color The color of the line in 16-bit RGB565 format.
- * @retval None
+ * @addtogroup TFT_Public_Functions
+ * @{
  */
-void TFT_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 color)
-{
-    /*<* Implement the TFT line drawing function */
-   
-}
 
-/**
- * @brief Displays an image on the TFT screen.
- *
- * This function displays an image stored in memory at the specified (x, y) coordinates.
- *
- * @param[in] x The X-coordinate where the image will be displayed.
- * @param[in] y The Y-coordinate where the image will be displayed.
- * @param[in] image Pointer to the image data in RGB565 format.
- * @param[in] width The width of the image in pixels.
- * @param[in] height The height of the image in pixels.
- * @retval None
- */
-void TFT_DisplayImage(u16 x, u16 y, const u16* image, u16 width, u16 height)
+Std_ReturnType TFT_ILI9481_Init(TFT_Device_t *Copy_Device, const TFT_ParallelBus_t *Copy_Bus)
 {
-    /**< Implement the TFT image display function */
-    
+    if ((Copy_Device == NULL) || (Copy_Bus == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+#if TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL
+    /**< The 18-bit pixels are sent in three cycles of 8 bits, there is no transfer for them on a 16-bit bus */
+    if (Copy_Bus->TFT_BusWidth != TFT_BUS_8BIT)
+    {
+        return E_NOT_OK;
+    }
+#endif
+
+    /**< Bind the driver to the device */
+    Copy_Device->Ops = &TFT_ILI9481_Ops;
+    Copy_Device->Config = Copy_Bus;
+    Copy_Device->NativeWidth = TFT_DISPLAY_WIDTH;
+    Copy_Device->NativeHeight = TFT_DISPLAY_HEIGHT;
+    Copy_Device->FrameMemoryLines = TFT_FRAME_MEMORY_LINES;
+    Copy_Device->MadctlNatural = TFT_MADCTL_NATURAL;
+    Copy_Device->Width = TFT_DISPLAY_WIDTH;
+    Copy_Device->Height = TFT_DISPLAY_HEIGHT;
+
+    /**< Hardware reset */
+    TFT_ParallelReset(Copy_Bus);
+
+    /**< Configure the controller */
+    TFT_SendCommandSequence(Copy_Device, TFT_InitSequence);
+
+    /**< Apply the configured mounting orientation */
+    TFT_SetOrientation(Copy_Device, TFT_DEFAULT_ROTATION, TFT_MIRROR_NONE);
+
+    return E_OK;
 }
 
 /**
- * @brief Displays text on the TFT screen.
- *
- * This function displays text at the specified (x, y) coordinates with the given color.
- *
- * @param[in] x The X-coordinate where the text will be displayed.
- * @param[in] y The Y-coordinate where the text will be displayed.
- * @param[in] text Pointer to the text string to be displayed.
- * @param[in] font The font size and style to use for rendering the text.
- * @param[in] color The color of the text in 16-bit RGB565 format.
- * @retval None
+ * @} TFT_Public_Functions
  */
-//void TFT_voidDisplayText(u16 x, u16 y, const char* text, const Font_t* font, u16 color)
-//{
-//    /**< Implement the TFT text display function */
-//
-//}
 
 /**
  * @addtogroup TFT_Private_Functions
  * @{
  */
 
-static void TFT_SendCommand(const TFT_Config_t *Copy_psTftDisplay, const SPI_t Copy_psTheSpiTftUsed, u8 Copy_Command)
+static void TFT_SetWindow(const TFT_Device_t *Copy_Device, u16 Copy_XStart, u16 Copy_YStart, u16 Copy_XEnd, u16 Copy_YEnd)
 {
-    /**< Temp variable to receive the data in */
-    u8 Local_u8ReceivedData = 0;
-
-    /**< Set RS (Register Select) pin low to indicate command mode */ 
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RsPin, GPIO_LOW); 
-
-    /**<  Set CS (Chip Select) pin low to select the TFT display for communication */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_CsPin, GPIO_LOW); 
-
-    /**< Perform SPI data transfer to send the command byte */ 
-    SPI_voidTransfer(Copy_psTheSpiTftUsed, &Copy_Command, &Local_u8ReceivedData, 1); 
-
-    /**< Set CS pin high to release the TFT display */ 
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_CsPin, GPIO_HIGH); 
+    u8 Local_Params[4];
+
+    /**< Column range */
+    Local_Params[0] = (Copy_XStart >> 8) & 0xFF;
+    Local_Params[1] = Copy_XStart & 0xFF;
+    Local_Params[2] = (Copy_XEnd >> 8) & 0xFF;
+    Local_Params[3] = Copy_XEnd & 0xFF;
+    TFT_ParallelWriteCommand(Copy_Device->Config, TFT_SET_COLUMN_ADDRESS, Local_Params, 4);
+
+    /**< Page range */
+    Local_Params[0] = (Copy_YStart >> 8) & 0xFF;
+    Local_Params[1] = Copy_YStart & 0xFF;
+    Local_Params[2] = (Copy_YEnd >> 8) & 0xFF;
+    Local_Params[3] = Copy_YEnd & 0xFF;
+    TFT_ParallelWriteCommand(Copy_Device->Config, TFT_SET_PAGE_ADDRESS, Local_Params, 4);
+
+    /**< The pixels that follow go to the window */
+    TFT_ParallelWriteCommand(Copy_Device->Config, TFT_WRITE_MEMORY_START, NULL, 0);
 }
 
-static void TFT_SendData(const TFT_Config_t *Copy_psTftDisplay, const SPI_t Copy_psTheSpiTftUsed, u8 Copy_Data)
+static void TFT_WritePixels(const TFT_Device_t *Copy_Device, const u16 *Copy_Pixels, u32 Copy_Count)
 {
-    /**< Temp variable to receive the data in */
-    u8 Local_u8ReceivedData = 0;
-
-    /**< Set RS (Register Select) pin high to indicate data mode */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RsPin, GPIO_HIGH);
-
-    /**< Set CS (Chip Select) pin low to select the TFT display for communication */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_CsPin, GPIO_LOW);
-
-    /**< Perform SPI data transfer to send the data byte */
-    SPI_voidTransfer(Copy_psTheSpiTftUsed, &Copy_Data, &Local_u8ReceivedData, 1);
-
-    /**< Set CS pin high to release the TFT display */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_CsPin, GPIO_HIGH);
+#if TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL
+    TFT_ParallelWritePixels666(Copy_Device->Config, Copy_Pixels, Copy_Count);
+#else
+    TFT_ParallelWritePixels(Copy_Device->Config, Copy_Pixels, Copy_Count);
+#endif
 }
 
-static void TFT_InitController(const TFT_Config_t *Copy_psTftDisplay, SPI_t Copy_psTheSpiTftUsed)
+static void TFT_WriteColor(const TFT_Device_t *Copy_Device, u16 Copy_Color, u32 Copy_Count)
 {
-    /**< Configure ILI9481 display */ 
-
-    /**< Send command to exit sleep mode */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x11);
-    STK_SetDelay(20);
-
-    /**< Send command to configure power setting */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xD0);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x07);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x42);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x18);
-
-    /**< Send command to configure address mode */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xD1);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x07);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x10);
-
-    /**< Send command to configure display mode */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xD2);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x01);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x02);
-
-    /**< Send command to configure gamma setting */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xC0);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x10);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x3B);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x02);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x11);
-
-    /**< Send command to configure frame rate and inversion control */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xC5);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x03);
-
-    /**< Send command to configure gamma settings */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xC8);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x32);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x36);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x45);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x06);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x16);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x37);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x75);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x77);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x54);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x0C);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-
-    /**< Send command to set scroll area */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x36);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x0A);
-
-    /**< Send command to set pixel format */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x3A);
-    #if (TFT_DISPLAY_COLORS == _3BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _16BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL)
-        TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, TFT_DISPLAY_COLORS);
-    #else
-        TFT_SendCommand(Copy_psTftDisplay, 0x21);
-    #endif
-
-    /**< Send command to set column address */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x2A);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x01);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x3F);
-
-    /**< Send command to set page address */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x2B);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x01);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xE0);
-
-    STK_SetDelay(120);
-    /**< Send command to exit idle mode */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x29);
-
-    /**< End of ILI9481 display configuration */
+#if TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL
+    TFT_ParallelWriteColor666(Copy_Device->Config, Copy_Color, Copy_Count);
+#else
+    TFT_ParallelWriteColor(Copy_Device->Config, Copy_Color, Copy_Count);
+#endif
 }
 
+static void TFT_WriteCommand(const TFT_Device_t *Copy_Device, u8 Copy_Command, const u8 *Copy_Params, u8 Copy_ParamCount)
+{
+    TFT_ParallelWriteCommand(Copy_Device->Config, Copy_Command, Copy_Params, Copy_ParamCount);
+}
 
 /**
  * @} TFT_Private_Functions
  */
 
+/**<====================================================================================================================*/
+/*******************************************< End of Functions Implementation *******************************************/
+/**<====================================================================================================================*/
+
 /** @} */ // End of TFT_Displays_program.c module.
@@ -0,0 +1,135 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Parallel_interface.h
+ * @brief This file contains the interface of the 8080 parallel bus used by the TFT drivers.
+ *
+ * The data lines DB0..DB7 (8-bit bus) or DB0..DB15 (16-bit bus) sit on consecutive pins of
+ * one GPIO port, so every bus cycle is one store to the port BSRR register followed by the
+ * WR strobe. Pixels are latched on the rising edge of WR.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_PARALLEL_INTERFACE_H__
+#define __TFT_PARALLEL_INTERFACE_H__
+
+/**
+ * @note Include TFT_Device_interface.h before this file.
+ */
+
+/**
+ * @addtogroup TFT_Parallel_Types
+ * @{
+ */
+
+/**
+ * @brief Width of the data bus.
+ */
+typedef enum
+{
+    TFT_BUS_8BIT = 0,       /**< DB0..DB7, RGB565 pixels take two cycles (high byte first) */
+    TFT_BUS_16BIT           /**< DB0..DB15, RGB565 pixels take one cycle */
+} TFT_BusWidth_t;
+
+/**
+ * @brief 8080 parallel bus configuration.
+ *
+ * All the pins must be configured as push-pull outputs (50 MHz) before the bus is used, with CS, WR and RST high.
+ */
+typedef struct
+{
+    u8 TFT_DataPort;                /**< GPIO port of the data lines */
+    u8 TFT_DataShift;               /**< Pin of DB0: GPIO_PIN0, or GPIO_PIN8 for an 8-bit bus on the high half of the port */
+    TFT_BusWidth_t TFT_BusWidth;    /**< Width of the data bus */
+    TFT_PinPairs TFT_CSPin;         /**< Chip Select (CS) pin */
+    TFT_PinPairs TFT_RSPin;         /**< Register Select (RS, D/C) pin, low for commands and high for data */
+    TFT_PinPairs TFT_WRPin;         /**< Write strobe (WR) pin */
+    TFT_PinPairs TFT_RSTPin;        /**< Reset (RST) pin */
+} TFT_ParallelBus_t;
+
+/** @} TFT_Parallel_Types */
+
+/**
+ * @addtogroup TFT_Parallel_Functions
+ * @{
+ */
+
+/**
+ * @brief Pulses the reset pin of the controller.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @retval None
+ */
+void TFT_ParallelReset(const TFT_ParallelBus_t *Copy_Bus);
+
+/**
+ * @brief Writes a command followed by its parameters.
+ *
+ * The parameters are written on DB0..DB7, one per cycle, whatever the bus width.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Command The command byte.
+ * @param[in] Copy_Params Pointer to the parameter bytes.
+ * @param[in] Copy_ParamCount The number of parameter bytes.
+ * @retval None
+ */
+void TFT_ParallelWriteCommand(const TFT_ParallelBus_t *Copy_Bus, u8 Copy_Command, const u8 *Copy_Params, u8 Copy_ParamCount);
+
+/**
+ * @brief Streams RGB565 pixels to the controller memory.
+ *
+ * The memory write command must have been sent before.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Pixels Pointer to the pixels in 16-bit RGB565 format.
+ * @param[in] Copy_Count The number of pixels.
+ * @retval None
+ */
+void TFT_ParallelWritePixels(const TFT_ParallelBus_t *Copy_Bus, const u16 *Copy_Pixels, u32 Copy_Count);
+
+/**
+ * @brief Streams the same RGB565 color a number of times to the controller memory.
+ *
+ * The data lines are set once and only WR is toggled, except on an 8-bit bus when the two bytes of the color differ.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @param[in] Copy_Count The number of pixels.
+ * @retval None
+ */
+void TFT_ParallelWriteColor(const TFT_ParallelBus_t *Copy_Bus, u16 Copy_Color, u32 Copy_Count);
+
+/**
+ * @brief Streams RGB565 pixels to a controller configured for 18-bit pixels.
+ *
+ * Each pixel is converted to RGB666 on the fly and sent as three cycles (red, green, blue).
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Pixels Pointer to the pixels in 16-bit RGB565 format.
+ * @param[in] Copy_Count The number of pixels.
+ * @retval None
+ *
+ * @note Only the 8-bit bus is supported, nothing is sent on a 16-bit bus. The display drivers refuse that
+ * combination in their initialization.
+ */
+void TFT_ParallelWritePixels666(const TFT_ParallelBus_t *Copy_Bus, const u16 *Copy_Pixels, u32 Copy_Count);
+
+/**
+ * @brief Streams the same RGB565 color a number of times to a controller configured for 18-bit pixels.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @param[in] Copy_Count The number of pixels.
+ * @retval None
+ *
+ * @note Only the 8-bit bus is supported, nothing is sent on a 16-bit bus. The display drivers refuse that
+ * combination in their initialization.
+ */
+void TFT_ParallelWriteColor666(const TFT_ParallelBus_t *Copy_Bus, u16 Copy_Color, u32 Copy_Count);
+
+/** @} TFT_Parallel_Functions */
+
+#endif /**< __TFT_PARALLEL_INTERFACE_H__ */
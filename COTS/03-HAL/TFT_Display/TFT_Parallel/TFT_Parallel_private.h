@@ -0,0 +1,42 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Parallel_private.h
+ * @brief This file contains the private definitions of the 8080 parallel bus.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_PARALLEL_PRIVATE_H__
+#define __TFT_PARALLEL_PRIVATE_H__
+
+/**
+ * @brief BSRR word driving the data lines to a value: the value bits are set and the other data lines are reset.
+ *
+ * @param VALUE The bus value.
+ * @param SHIFT The pin of DB0.
+ * @param MASK The data lines mask, already shifted.
+ */
+#define TFT_PARALLEL_BEAT(VALUE, SHIFT, MASK)   ((((u32)(VALUE) << (SHIFT)) & (MASK)) | ((~((u32)(VALUE) << (SHIFT)) & (MASK)) << 16))
+
+/**
+ * @brief Selects the controller and sets the RS level for the cycles that follow.
+ *
+ * @param Copy_Bus Pointer to the bus configuration.
+ * @param Copy_RsLevel GPIO_LOW for a command, GPIO_HIGH for data.
+ */
+static void TFT_ParallelSelect(const TFT_ParallelBus_t *Copy_Bus, u8 Copy_RsLevel);
+
+/**
+ * @brief Writes one bus cycle: drives the data lines, then strobes WR.
+ *
+ * Used for commands and parameters, the pixel loops inline the same stores.
+ *
+ * @param Copy_Bus Pointer to the bus configuration.
+ * @param Copy_Value The bus value.
+ */
+static void TFT_ParallelWriteCycle(const TFT_ParallelBus_t *Copy_Bus, u16 Copy_Value);
+
+#endif /**< __TFT_PARALLEL_PRIVATE_H__ */
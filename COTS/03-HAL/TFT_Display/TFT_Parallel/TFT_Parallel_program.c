@@ -0,0 +1,265 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Parallel_program.c
+ * @brief This file contains the implementation of the 8080 parallel bus used by the TFT drivers.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "GPIO_interface.h"
+#include "DWT_interface.h"
+/**< HAL */
+#include "TFT_Device_interface.h"
+#include "TFT_Parallel_interface.h"
+#include "TFT_Parallel_private.h"
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void TFT_ParallelReset(const TFT_ParallelBus_t *Copy_Bus)
+{
+    GPIO_SetPinValue(Copy_Bus->TFT_RSTPin.TFT_Port, Copy_Bus->TFT_RSTPin.TFT_Pin, GPIO_HIGH);
+    DWT_DelayMs(5);
+    GPIO_SetPinValue(Copy_Bus->TFT_RSTPin.TFT_Port, Copy_Bus->TFT_RSTPin.TFT_Pin, GPIO_LOW);
+    DWT_DelayMs(15);
+    GPIO_SetPinValue(Copy_Bus->TFT_RSTPin.TFT_Port, Copy_Bus->TFT_RSTPin.TFT_Pin, GPIO_HIGH);
+    DWT_DelayMs(15);
+}
+
+void TFT_ParallelWriteCommand(const TFT_ParallelBus_t *Copy_Bus, u8 Copy_Command, const u8 *Copy_Params, u8 Copy_ParamCount)
+{
+    u8 Local_Iterator;
+
+    TFT_ParallelSelect(Copy_Bus, GPIO_LOW);
+    TFT_ParallelWriteCycle(Copy_Bus, Copy_Command);
+
+    /**< The parameters are data cycles */
+    GPIO_SetPinValue(Copy_Bus->TFT_RSPin.TFT_Port, Copy_Bus->TFT_RSPin.TFT_Pin, GPIO_HIGH);
+    for (Local_Iterator = 0; Local_Iterator < Copy_ParamCount; Local_Iterator++)
+    {
+        TFT_ParallelWriteCycle(Copy_Bus, Copy_Params[Local_Iterator]);
+    }
+
+    GPIO_SetPinValue(Copy_Bus->TFT_CSPin.TFT_Port, Copy_Bus->TFT_CSPin.TFT_Pin, GPIO_HIGH);
+}
+
+void TFT_ParallelWritePixels(const TFT_ParallelBus_t *Copy_Bus, const u16 *Copy_Pixels, u32 Copy_Count)
+{
+    volatile u32 *Local_DataPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_DataPort);
+    volatile u32 *Local_WrPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_WRPin.TFT_Port);
+    u32 Local_WrHigh = (u32)1 << Copy_Bus->TFT_WRPin.TFT_Pin;
+    u32 Local_WrLow = Local_WrHigh << 16;
+    u8  Local_Shift = Copy_Bus->TFT_DataShift;
+    u32 Local_Mask;
+
+    if ((Local_DataPort == NULL) || (Local_WrPort == NULL))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    TFT_ParallelSelect(Copy_Bus, GPIO_HIGH);
+
+    if (Copy_Bus->TFT_BusWidth == TFT_BUS_16BIT)
+    {
+        Local_Mask = 0xFFFF;
+
+        /**< One cycle per pixel */
+        while (Copy_Count > 0)
+        {
+            *Local_DataPort = TFT_PARALLEL_BEAT(*Copy_Pixels, 0, Local_Mask);
+            *Local_WrPort = Local_WrLow;
+            *Local_WrPort = Local_WrHigh;
+            Copy_Pixels++;
+            Copy_Count--;
+        }
+    }
+    else
+    {
+        Local_Mask = (u32)0xFF << Local_Shift;
+
+        /**< Two cycles per pixel, high byte first */
+        while (Copy_Count > 0)
+        {
+            *Local_DataPort = TFT_PARALLEL_BEAT(*Copy_Pixels >> 8, Local_Shift, Local_Mask);
+            *Local_WrPort = Local_WrLow;
+            *Local_WrPort = Local_WrHigh;
+            *Local_DataPort = TFT_PARALLEL_BEAT(*Copy_Pixels & 0xFF, Local_Shift, Local_Mask);
+            *Local_WrPort = Local_WrLow;
+            *Local_WrPort = Local_WrHigh;
+            Copy_Pixels++;
+            Copy_Count--;
+        }
+    }
+
+    GPIO_SetPinValue(Copy_Bus->TFT_CSPin.TFT_Port, Copy_Bus->TFT_CSPin.TFT_Pin, GPIO_HIGH);
+}
+
+void TFT_ParallelWriteColor(const TFT_ParallelBus_t *Copy_Bus, u16 Copy_Color, u32 Copy_Count)
+{
+    volatile u32 *Local_DataPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_DataPort);
+    volatile u32 *Local_WrPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_WRPin.TFT_Port);
+    u32 Local_WrHigh = (u32)1 << Copy_Bus->TFT_WRPin.TFT_Pin;
+    u32 Local_WrLow = Local_WrHigh << 16;
+    u8  Local_Shift = Copy_Bus->TFT_DataShift;
+    u32 Local_Mask = (u32)0xFF << Local_Shift;
+    u32 Local_HighBeat;
+    u32 Local_LowBeat;
+
+    if ((Local_DataPort == NULL) || (Local_WrPort == NULL))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    TFT_ParallelSelect(Copy_Bus, GPIO_HIGH);
+
+    if (Copy_Bus->TFT_BusWidth == TFT_BUS_16BIT)
+    {
+        /**< The data lines hold the color, the controller latches it on every WR edge */
+        *Local_DataPort = TFT_PARALLEL_BEAT(Copy_Color, 0, 0xFFFF);
+        while (Copy_Count > 0)
+        {
+            *Local_WrPort = Local_WrLow;
+            *Local_WrPort = Local_WrHigh;
+            Copy_Count--;
+        }
+    }
+    else if ((Copy_Color >> 8) == (Copy_Color & 0xFF))
+    {
+        /**< Both bytes are equal (black, white, ...): two WR strobes per pixel, the data lines never move */
+        *Local_DataPort = TFT_PARALLEL_BEAT(Copy_Color & 0xFF, Local_Shift, Local_Mask);
+        while (Copy_Count > 0)
+        {
+            *Local_WrPort = Local_WrLow;
+            *Local_WrPort = Local_WrHigh;
+            *Local_WrPort = Local_WrLow;
+            *Local_WrPort = Local_WrHigh;
+            Copy_Count--;
+        }
+    }
+    else
+    {
+        Local_HighBeat = TFT_PARALLEL_BEAT(Copy_Color >> 8, Local_Shift, Local_Mask);
+        Local_LowBeat = TFT_PARALLEL_BEAT(Copy_Color & 0xFF, Local_Shift, Local_Mask);
+        while (Copy_Count > 0)
+        {
+            *Local_DataPort = Local_HighBeat;
+            *Local_WrPort = Local_WrLow;
+            *Local_WrPort = Local_WrHigh;
+            *Local_DataPort = Local_LowBeat;
+            *Local_WrPort = Local_WrLow;
+            *Local_WrPort = Local_WrHigh;
+            Copy_Count--;
+        }
+    }
+
+    GPIO_SetPinValue(Copy_Bus->TFT_CSPin.TFT_Port, Copy_Bus->TFT_CSPin.TFT_Pin, GPIO_HIGH);
+}
+
+void TFT_ParallelWritePixels666(const TFT_ParallelBus_t *Copy_Bus, const u16 *Copy_Pixels, u32 Copy_Count)
+{
+    volatile u32 *Local_DataPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_DataPort);
+    volatile u32 *Local_WrPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_WRPin.TFT_Port);
+    u32 Local_WrHigh = (u32)1 << Copy_Bus->TFT_WRPin.TFT_Pin;
+    u32 Local_WrLow = Local_WrHigh << 16;
+    u8  Local_Shift = Copy_Bus->TFT_DataShift;
+    u32 Local_Mask = (u32)0xFF << Local_Shift;
+
+    if ((Local_DataPort == NULL) || (Local_WrPort == NULL) || (Copy_Bus->TFT_BusWidth != TFT_BUS_8BIT))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    TFT_ParallelSelect(Copy_Bus, GPIO_HIGH);
+
+    /**< Three cycles per pixel, the channels are widened while they are sent */
+    while (Copy_Count > 0)
+    {
+        *Local_DataPort = TFT_PARALLEL_BEAT(TFT_RGB666_RED(*Copy_Pixels), Local_Shift, Local_Mask);
+        *Local_WrPort = Local_WrLow;
+        *Local_WrPort = Local_WrHigh;
+        *Local_DataPort = TFT_PARALLEL_BEAT(TFT_RGB666_GREEN(*Copy_Pixels), Local_Shift, Local_Mask);
+        *Local_WrPort = Local_WrLow;
+        *Local_WrPort = Local_WrHigh;
+        *Local_DataPort = TFT_PARALLEL_BEAT(TFT_RGB666_BLUE(*Copy_Pixels), Local_Shift, Local_Mask);
+        *Local_WrPort = Local_WrLow;
+        *Local_WrPort = Local_WrHigh;
+        Copy_Pixels++;
+        Copy_Count--;
+    }
+
+    GPIO_SetPinValue(Copy_Bus->TFT_CSPin.TFT_Port, Copy_Bus->TFT_CSPin.TFT_Pin, GPIO_HIGH);
+}
+
+void TFT_ParallelWriteColor666(const TFT_ParallelBus_t *Copy_Bus, u16 Copy_Color, u32 Copy_Count)
+{
+    volatile u32 *Local_DataPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_DataPort);
+    volatile u32 *Local_WrPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_WRPin.TFT_Port);
+    u32 Local_WrHigh = (u32)1 << Copy_Bus->TFT_WRPin.TFT_Pin;
+    u32 Local_WrLow = Local_WrHigh << 16;
+    u8  Local_Shift = Copy_Bus->TFT_DataShift;
+    u32 Local_Mask = (u32)0xFF << Local_Shift;
+    u32 Local_RedBeat;
+    u32 Local_GreenBeat;
+    u32 Local_BlueBeat;
+
+    if ((Local_DataPort == NULL) || (Local_WrPort == NULL) || (Copy_Bus->TFT_BusWidth != TFT_BUS_8BIT))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    /**< Convert once, outside the loop */
+    Local_RedBeat = TFT_PARALLEL_BEAT(TFT_RGB666_RED(Copy_Color), Local_Shift, Local_Mask);
+    Local_GreenBeat = TFT_PARALLEL_BEAT(TFT_RGB666_GREEN(Copy_Color), Local_Shift, Local_Mask);
+    Local_BlueBeat = TFT_PARALLEL_BEAT(TFT_RGB666_BLUE(Copy_Color), Local_Shift, Local_Mask);
+
+    TFT_ParallelSelect(Copy_Bus, GPIO_HIGH);
+
+    while (Copy_Count > 0)
+    {
+        *Local_DataPort = Local_RedBeat;
+        *Local_WrPort = Local_WrLow;
+        *Local_WrPort = Local_WrHigh;
+        *Local_DataPort = Local_GreenBeat;
+        *Local_WrPort = Local_WrLow;
+        *Local_WrPort = Local_WrHigh;
+        *Local_DataPort = Local_BlueBeat;
+        *Local_WrPort = Local_WrLow;
+        *Local_WrPort = Local_WrHigh;
+        Copy_Count--;
+    }
+
+    GPIO_SetPinValue(Copy_Bus->TFT_CSPin.TFT_Port, Copy_Bus->TFT_CSPin.TFT_Pin, GPIO_HIGH);
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void TFT_ParallelSelect(const TFT_ParallelBus_t *Copy_Bus, u8 Copy_RsLevel)
+{
+    GPIO_SetPinValue(Copy_Bus->TFT_RSPin.TFT_Port, Copy_Bus->TFT_RSPin.TFT_Pin, Copy_RsLevel);
+    GPIO_SetPinValue(Copy_Bus->TFT_CSPin.TFT_Port, Copy_Bus->TFT_CSPin.TFT_Pin, GPIO_LOW);
+}
+
+static void TFT_ParallelWriteCycle(const TFT_ParallelBus_t *Copy_Bus, u16 Copy_Value)
+{
+    volatile u32 *Local_DataPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_DataPort);
+    volatile u32 *Local_WrPort = GPIO_GetSetResetRegister(Copy_Bus->TFT_WRPin.TFT_Port);
+    u8  Local_Shift = (Copy_Bus->TFT_BusWidth == TFT_BUS_16BIT) ? 0 : Copy_Bus->TFT_DataShift;
+    u32 Local_Mask = (Copy_Bus->TFT_BusWidth == TFT_BUS_16BIT) ? 0xFFFF : ((u32)0xFF << Local_Shift);
+
+    if ((Local_DataPort == NULL) || (Local_WrPort == NULL))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    *Local_DataPort = TFT_PARALLEL_BEAT(Copy_Value, Local_Shift, Local_Mask);
+    *Local_WrPort = (u32)1 << (Copy_Bus->TFT_WRPin.TFT_Pin + 16);
+    *Local_WrPort = (u32)1 << Copy_Bus->TFT_WRPin.TFT_Pin;
+}
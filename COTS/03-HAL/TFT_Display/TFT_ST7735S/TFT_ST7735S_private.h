@@ -127,6 +127,7 @@
 #define TFT_TEOFF            0x34   /**< Tearing effect line off */
 #define TFT_TEON             0x35   /**< Tearing Effect Mode Set & On */
 #define TFT_MADCTL           0x36   /**< Memory Control Data Access */
+
 #define TFT_VSCSAD           0x37   /**< Scroll RAM Start Address of SSA */
 
 /**< Interface Pixel Format and Self-diagnostic Commands */
@@ -209,256 +210,43 @@
  */
 
 /**
- * @brief Internal function to send commands to the TFT display controller.
- *
- * This function is used internally to send commands to the TFT display controller
- * using the specified communication interface.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral to be used for communication.
- * @param Copy_Command The command byte to be sent.
- *
- * @note Make sure to properly configure the TFT display and SPI functions before calling this function.
+ * @brief Device operation: open an address window and start a memory write.
  *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Send a command (e.g., 0xA1) to the TFT display
- * TFT_SendCommand(&tftConfig, spiPeripheral, 0xA1);
- * @endcode
+ * @param Copy_Device Pointer to the display.
+ * @param Copy_XStart The first column of the window.
+ * @param Copy_YStart The first row of the window.
+ * @param Copy_XEnd The last column of the window (inclusive).
+ * @param Copy_YEnd The last row of the window (inclusive).
  */
-static void TFT_SendCommand(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Command);
+static void TFT_SetWindow(const TFT_Device_t *Copy_Device, u16 Copy_XStart, u16 Copy_YStart, u16 Copy_XEnd, u16 Copy_YEnd);
 
 /**
- * @brief Send data to the TFT display using SPI communication.
- *
- * This function sends a single data byte to the TFT display using the specified SPI peripheral.
- * It sets the RS (Register Select) pin to high to indicate data mode, selects the TFT display by
- * setting the CS (Chip Select) pin low, performs an SPI data transfer to send the data byte, and
- * then releases the display by setting the CS pin high again.
+ * @brief Device operation: stream an array of pixels into the open window.
  *
- * @param[in] Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param[in] Copy_psSpiPeripheral The SPI peripheral to be used for communication.
- * @param[in] Copy_Data The data byte to be sent to the TFT display.
- *
- * @return None.
- *
- * @note Make sure to properly configure the TFT display and GPIO functions before calling this function.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Send data (e.g., 0x55) to the TFT display
- * TFT_SendData(spiPeripheral, &tftConfig, 0x55);
- * @endcode
+ * @param Copy_Device Pointer to the display.
+ * @param Copy_Pixels Pointer to the pixels in 16-bit RGB565 format.
+ * @param Copy_Count The number of pixels to write.
  */
-static void TFT_SendData(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Data);
+static void TFT_WritePixels(const TFT_Device_t *Copy_Device, const u16 *Copy_Pixels, u32 Copy_Count);
 
 /**
- * @brief Draw a pixel on the TFT display.
- *
- * This function is used to draw a pixel on the TFT display at the specified
- * coordinates using the specified color. It encapsulates the process of setting
- * the X and Y addresses, sending the RAM write command, and sending the color data
- * to the display.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral used for communication.
- * @param Copy_XPosition The x-coordinate of the pixel.
- * @param Copy_YPosition The y-coordinate of the pixel.
- * @param color The color of the pixel in 16-bit RGB565 format.
+ * @brief Device operation: stream the same color a number of times into the open window.
  *
- * @note Make sure to properly configure the TFT display, SPI, and GPIO functions
- *       before calling this function.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Draw a red pixel at (100, 50)
- * TFT_DrawPixel(&tftConfig, spiPeripheral, 100, 50, TFT_COLOR_RED);
- * @endcode
+ * @param Copy_Device Pointer to the display.
+ * @param Copy_Color The color in 16-bit RGB565 format.
+ * @param Copy_Count The number of pixels to write.
  */
-static void TFT_DrawPixel(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 color);
+static void TFT_WriteColor(const TFT_Device_t *Copy_Device, u16 Copy_Color, u32 Copy_Count);
 
 /**
- * @brief Set the X address on the TFT display controller.
- *
- * This function sends the necessary commands to the TFT display controller
- * to set the X address for drawing pixels. The provided X coordinate specifies
- * the horizontal position where the next pixel will be drawn.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral used for communication.
- * @param Copy_XPosition The X coordinate to set for drawing.
- *
- * @note This function should be called before drawing any pixel to set the desired
- *       horizontal position on the TFT display.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
+ * @brief Device operation: send a command followed by its parameters.
  *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Set the X address to 100
- * TFT_SetXAddress(&tftConfig, spiPeripheral, 100);
- * @endcode
+ * @param Copy_Device Pointer to the display.
+ * @param Copy_Command The command byte.
+ * @param Copy_Params Pointer to the parameter bytes.
+ * @param Copy_ParamCount The number of parameter bytes.
  */
-static void TFT_SetXAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition);
-
-/**
- * @brief Set the Y address on the TFT display controller.
- *
- * This function sends the necessary commands to the TFT display controller
- * to set the Y address for drawing pixels. The provided Y coordinate specifies
- * the vertical position where the next pixel will be drawn.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral used for communication.
- * @param Copy_YPosition The Y coordinate to set for drawing.
- *
- * @note This function should be called before drawing any pixel to set the desired
- *       vertical position on the TFT display.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Set the Y address to 50
- * TFT_SetYAddress(&tftConfig, spiPeripheral, 50);
- * @endcode
- */
-static void TFT_SetYAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_YPosition);
-
-/**
- * @brief Set the X and Y addresses on the TFT display controller.
- *
- * This function sends the necessary commands to the TFT display controller
- * to set both the X and Y addresses for drawing pixels. The provided X and Y
- * coordinates specify the horizontal and vertical positions where the next pixel
- * will be drawn.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral used for communication.
- * @param Copy_XPosition The X coordinate to set for drawing.
- * @param Copy_YPosition The Y coordinate to set for drawing.
- *
- * @note This function should be called before drawing any pixel to set the desired
- *       position on the TFT display.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Set the X and Y addresses to 100 and 50 respectively
- * TFT_SetXYAddress(&tftConfig, spiPeripheral, 100, 50);
- * @endcode
- */
-static void TFT_SetXYAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition);
-
-/**
- * @brief Internal function to initialize the TFT display controller.
- *
- * This function is used internally to initialize the TFT display controller
- * based on the configuration settings provided in the TFT_Config_t structure.
- * It configures the display controller's parameters and settings to ensure proper
- * communication and display behavior.
- *
- * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_SpiPeripheral The SPI peripheral used for communication.
- *
- * @note This function should be called during the initialization process of the TFT display module.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Initialize the TFT display controller
- * TFT_InitController(&tftConfig, spiPeripheral);
- * @endcode
- */
-static void TFT_InitController(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral);
-
-/**
- * @brief Internal function to draw a character on the TFT display.
- *
- * This function is used internally to draw a character on the TFT display at the specified
- * coordinates using the specified font and color.
- *
- * @param x The x-coordinate of the character.
- * @param y The y-coordinate of the character.
- * @param character The character to be drawn.
- * @param font Pointer to the font data structure.
- * @param textColor The color of the character in 16-bit RGB565 format.
- * @param backgroundColor The background color of the character in 16-bit RGB565 format.
- */
-//static void TFT_DrawCharacter(u16 x, u16 y, char character, const Font_t *font, u16 textColor, u16 backgroundColor);
-
-/* Add more internal functions and private declarations as needed */
+static void TFT_WriteCommand(const TFT_Device_t *Copy_Device, u8 Copy_Command, const u8 *Copy_Params, u8 Copy_ParamCount);
 
 /** @} TFT_Private_Functions */
 
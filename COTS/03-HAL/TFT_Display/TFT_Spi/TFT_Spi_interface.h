@@ -0,0 +1,118 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Spi_interface.h
+ * @brief This file contains the interface of the 4-wire SPI bus used by the TFT drivers.
+ *
+ * Commands and data share the SPI lines, DC selects between them (low for a command, high
+ * for data). Pixel streams are packed in a stack buffer and sent in bursts, the chip select
+ * stays asserted for the whole stream.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_SPI_INTERFACE_H__
+#define __TFT_SPI_INTERFACE_H__
+
+/**
+ * @note Include TFT_Device_interface.h and SPI_interface.h before this file.
+ */
+
+/**
+ * @addtogroup TFT_Spi_Types
+ * @{
+ */
+
+/**
+ * @brief 4-wire SPI bus configuration.
+ *
+ * The pins must be configured as push-pull outputs and the SPI peripheral initialized before the bus is used.
+ */
+typedef struct
+{
+    TFT_PinPairs TFT_CSPin;     /**< Chip Select (CS) pin configuration. */
+    TFT_PinPairs TFT_DCPin;     /**< Data/Command Control (DC) pin configuration. */
+    TFT_PinPairs TFT_SDAPin;    /**< Serial Data Input (SDA) pin configuration. */
+    TFT_PinPairs TFT_RESPin;    /**< LCM Reset (RES) pin configuration. */
+    SPI_t TFT_Spi;              /**< SPI peripheral connected to the display. */
+} TFT_SpiBus_t;
+
+/** @} TFT_Spi_Types */
+
+/**
+ * @addtogroup TFT_Spi_Functions
+ * @{
+ */
+
+/**
+ * @brief Pulses the reset pin of the controller.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @retval None
+ */
+void TFT_SpiReset(const TFT_SpiBus_t *Copy_Bus);
+
+/**
+ * @brief Writes a command followed by its parameters.
+ *
+ * The command and its parameters are sent in two chip select sessions, the parameters back to back.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Command The command byte.
+ * @param[in] Copy_Params Pointer to the parameter bytes.
+ * @param[in] Copy_ParamCount The number of parameter bytes.
+ * @retval None
+ */
+void TFT_SpiWriteCommand(const TFT_SpiBus_t *Copy_Bus, u8 Copy_Command, const u8 *Copy_Params, u8 Copy_ParamCount);
+
+/**
+ * @brief Streams RGB565 pixels to the controller memory.
+ *
+ * The memory write command must have been sent before. Each pixel is sent high byte first.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Pixels Pointer to the pixels in 16-bit RGB565 format.
+ * @param[in] Copy_Count The number of pixels.
+ * @retval None
+ */
+void TFT_SpiWritePixels(const TFT_SpiBus_t *Copy_Bus, const u16 *Copy_Pixels, u32 Copy_Count);
+
+/**
+ * @brief Streams the same RGB565 color a number of times to the controller memory.
+ *
+ * The burst buffer is filled once and sent as many times as needed.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @param[in] Copy_Count The number of pixels.
+ * @retval None
+ */
+void TFT_SpiWriteColor(const TFT_SpiBus_t *Copy_Bus, u16 Copy_Color, u32 Copy_Count);
+
+/**
+ * @brief Streams RGB565 pixels to a controller configured for 18-bit pixels.
+ *
+ * Each pixel is converted to RGB666 while the bursts are packed and sent as three bytes (red, green, blue).
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Pixels Pointer to the pixels in 16-bit RGB565 format.
+ * @param[in] Copy_Count The number of pixels.
+ * @retval None
+ */
+void TFT_SpiWritePixels666(const TFT_SpiBus_t *Copy_Bus, const u16 *Copy_Pixels, u32 Copy_Count);
+
+/**
+ * @brief Streams the same RGB565 color a number of times to a controller configured for 18-bit pixels.
+ *
+ * @param[in] Copy_Bus Pointer to the bus configuration.
+ * @param[in] Copy_Color The color in 16-bit RGB565 format.
+ * @param[in] Copy_Count The number of pixels.
+ * @retval None
+ */
+void TFT_SpiWriteColor666(const TFT_SpiBus_t *Copy_Bus, u16 Copy_Color, u32 Copy_Count);
+
+/** @} TFT_Spi_Functions */
+
+#endif /**< __TFT_SPI_INTERFACE_H__ */
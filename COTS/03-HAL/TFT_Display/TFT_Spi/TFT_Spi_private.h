@@ -0,0 +1,51 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Spi_private.h
+ * @brief This file contains the private definitions of the 4-wire SPI bus.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_SPI_PRIVATE_H__
+#define __TFT_SPI_PRIVATE_H__
+
+/**
+ * @brief Number of pixels packed in the stack buffer used for SPI bursts.
+ *
+ * Pixel streams are split into chunks of this many pixels. The chunks are streamed without waiting for
+ * the bus and the chip select stays asserted for the whole stream, so the chunk size only trades stack
+ * usage against the per-chunk call overhead.
+ */
+#define TFT_SPI_BURST_PIXELS    16
+
+/**
+ * @brief Selects the controller and sets the DC level for the bytes that follow.
+ *
+ * @param Copy_Bus Pointer to the bus configuration.
+ * @param Copy_DcLevel GPIO_LOW for a command, GPIO_HIGH for data.
+ */
+static void TFT_SpiSelect(const TFT_SpiBus_t *Copy_Bus, u8 Copy_DcLevel);
+
+/**
+ * @brief Waits for the last bytes to be shifted out, then releases the controller.
+ *
+ * @param Copy_Bus Pointer to the bus configuration.
+ */
+static void TFT_SpiRelease(const TFT_SpiBus_t *Copy_Bus);
+
+/**
+ * @brief Sends a burst buffer a number of times, then releases the controller.
+ *
+ * Used by the color fills, the buffer holds TFT_SPI_BURST_PIXELS pixels of the same color.
+ *
+ * @param Copy_Bus Pointer to the bus configuration.
+ * @param Copy_Burst Pointer to the packed burst buffer.
+ * @param Copy_PixelBytes The number of bytes per pixel in the buffer.
+ * @param Copy_Count The number of pixels to send.
+ */
+static void TFT_SpiRepeatBurst(const TFT_SpiBus_t *Copy_Bus, const u8 *Copy_Burst, u8 Copy_PixelBytes, u32 Copy_Count);
+
+#endif /**< __TFT_SPI_PRIVATE_H__ */
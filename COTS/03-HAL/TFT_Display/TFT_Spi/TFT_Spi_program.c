@@ -0,0 +1,164 @@
+/**
+ ********************************************************************************************
+ * @file TFT_Spi_program.c
+ * @brief This file contains the implementation of the 4-wire SPI bus used by the TFT drivers.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "GPIO_interface.h"
+#include "SPI_interface.h"
+#include "DWT_interface.h"
+/**< HAL */
+#include "TFT_Device_interface.h"
+#include "TFT_Spi_interface.h"
+#include "TFT_Spi_private.h"
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void TFT_SpiReset(const TFT_SpiBus_t *Copy_Bus)
+{
+    GPIO_SetPinValue(Copy_Bus->TFT_RESPin.TFT_Port, Copy_Bus->TFT_RESPin.TFT_Pin, GPIO_HIGH);
+    DWT_DelayMs(5);
+    GPIO_SetPinValue(Copy_Bus->TFT_RESPin.TFT_Port, Copy_Bus->TFT_RESPin.TFT_Pin, GPIO_LOW);
+    DWT_DelayMs(15);
+    GPIO_SetPinValue(Copy_Bus->TFT_RESPin.TFT_Port, Copy_Bus->TFT_RESPin.TFT_Pin, GPIO_HIGH);
+    DWT_DelayMs(15);
+}
+
+void TFT_SpiWriteCommand(const TFT_SpiBus_t *Copy_Bus, u8 Copy_Command, const u8 *Copy_Params, u8 Copy_ParamCount)
+{
+    TFT_SpiSelect(Copy_Bus, GPIO_LOW);
+    SPI_voidStream(Copy_Bus->TFT_Spi, &Copy_Command, 1);
+    TFT_SpiRelease(Copy_Bus);
+
+    if (Copy_ParamCount > 0)
+    {
+        /**< The parameters are data bytes, sent back to back */
+        TFT_SpiSelect(Copy_Bus, GPIO_HIGH);
+        SPI_voidStream(Copy_Bus->TFT_Spi, Copy_Params, Copy_ParamCount);
+        TFT_SpiRelease(Copy_Bus);
+    }
+}
+
+void TFT_SpiWritePixels(const TFT_SpiBus_t *Copy_Bus, const u16 *Copy_Pixels, u32 Copy_Count)
+{
+    u8  Local_Burst[TFT_SPI_BURST_PIXELS * 2];
+    u32 Local_Chunk;
+    u8  Local_Iterator;
+
+    TFT_SpiSelect(Copy_Bus, GPIO_HIGH);
+
+    while (Copy_Count > 0)
+    {
+        Local_Chunk = (Copy_Count > TFT_SPI_BURST_PIXELS) ? TFT_SPI_BURST_PIXELS : Copy_Count;
+
+        /**< Two bytes per pixel, high byte first */
+        for (Local_Iterator = 0; Local_Iterator < Local_Chunk; Local_Iterator++)
+        {
+            Local_Burst[2 * Local_Iterator]     = (Copy_Pixels[Local_Iterator] >> 8) & 0xFF;
+            Local_Burst[2 * Local_Iterator + 1] = Copy_Pixels[Local_Iterator] & 0xFF;
+        }
+
+        SPI_voidStream(Copy_Bus->TFT_Spi, Local_Burst, (u16)(Local_Chunk * 2));
+        Copy_Pixels += Local_Chunk;
+        Copy_Count  -= Local_Chunk;
+    }
+
+    TFT_SpiRelease(Copy_Bus);
+}
+
+void TFT_SpiWriteColor(const TFT_SpiBus_t *Copy_Bus, u16 Copy_Color, u32 Copy_Count)
+{
+    u8 Local_Burst[TFT_SPI_BURST_PIXELS * 2];
+    u8 Local_Iterator;
+
+    /**< Fill the burst buffer once, it is sent as many times as needed */
+    for (Local_Iterator = 0; Local_Iterator < TFT_SPI_BURST_PIXELS; Local_Iterator++)
+    {
+        Local_Burst[2 * Local_Iterator]     = (Copy_Color >> 8) & 0xFF;  /**< High byte of color */
+        Local_Burst[2 * Local_Iterator + 1] = Copy_Color & 0xFF;         /**< Low byte of color */
+    }
+
+    TFT_SpiRepeatBurst(Copy_Bus, Local_Burst, 2, Copy_Count);
+}
+
+void TFT_SpiWritePixels666(const TFT_SpiBus_t *Copy_Bus, const u16 *Copy_Pixels, u32 Copy_Count)
+{
+    u8  Local_Burst[TFT_SPI_BURST_PIXELS * 3];
+    u32 Local_Chunk;
+    u8  Local_Iterator;
+
+    TFT_SpiSelect(Copy_Bus, GPIO_HIGH);
+
+    while (Copy_Count > 0)
+    {
+        Local_Chunk = (Copy_Count > TFT_SPI_BURST_PIXELS) ? TFT_SPI_BURST_PIXELS : Copy_Count;
+
+        /**< Three bytes per pixel, the channels are widened while they are packed */
+        for (Local_Iterator = 0; Local_Iterator < Local_Chunk; Local_Iterator++)
+        {
+            Local_Burst[3 * Local_Iterator]     = TFT_RGB666_RED(Copy_Pixels[Local_Iterator]);
+            Local_Burst[3 * Local_Iterator + 1] = TFT_RGB666_GREEN(Copy_Pixels[Local_Iterator]);
+            Local_Burst[3 * Local_Iterator + 2] = TFT_RGB666_BLUE(Copy_Pixels[Local_Iterator]);
+        }
+
+        SPI_voidStream(Copy_Bus->TFT_Spi, Local_Burst, (u16)(Local_Chunk * 3));
+        Copy_Pixels += Local_Chunk;
+        Copy_Count  -= Local_Chunk;
+    }
+
+    TFT_SpiRelease(Copy_Bus);
+}
+
+void TFT_SpiWriteColor666(const TFT_SpiBus_t *Copy_Bus, u16 Copy_Color, u32 Copy_Count)
+{
+    u8 Local_Burst[TFT_SPI_BURST_PIXELS * 3];
+    u8 Local_Iterator;
+
+    /**< Convert once, outside the loop */
+    for (Local_Iterator = 0; Local_Iterator < TFT_SPI_BURST_PIXELS; Local_Iterator++)
+    {
+        Local_Burst[3 * Local_Iterator]     = TFT_RGB666_RED(Copy_Color);
+        Local_Burst[3 * Local_Iterator + 1] = TFT_RGB666_GREEN(Copy_Color);
+        Local_Burst[3 * Local_Iterator + 2] = TFT_RGB666_BLUE(Copy_Color);
+    }
+
+    TFT_SpiRepeatBurst(Copy_Bus, Local_Burst, 3, Copy_Count);
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void TFT_SpiSelect(const TFT_SpiBus_t *Copy_Bus, u8 Copy_DcLevel)
+{
+    GPIO_SetPinValue(Copy_Bus->TFT_CSPin.TFT_Port, Copy_Bus->TFT_CSPin.TFT_Pin, GPIO_LOW);
+    GPIO_SetPinValue(Copy_Bus->TFT_DCPin.TFT_Port, Copy_Bus->TFT_DCPin.TFT_Pin, Copy_DcLevel);
+}
+
+static void TFT_SpiRelease(const TFT_SpiBus_t *Copy_Bus)
+{
+    /**< The last bytes must leave the shift register before the controller is released */
+    SPI_voidWaitIdle(Copy_Bus->TFT_Spi);
+    GPIO_SetPinValue(Copy_Bus->TFT_CSPin.TFT_Port, Copy_Bus->TFT_CSPin.TFT_Pin, GPIO_HIGH);
+}
+
+static void TFT_SpiRepeatBurst(const TFT_SpiBus_t *Copy_Bus, const u8 *Copy_Burst, u8 Copy_PixelBytes, u32 Copy_Count)
+{
+    u32 Local_Chunk;
+
+    /**< Keep the display selected in data mode for the whole stream */
+    TFT_SpiSelect(Copy_Bus, GPIO_HIGH);
+
+    while (Copy_Count > 0)
+    {
+        Local_Chunk = (Copy_Count > TFT_SPI_BURST_PIXELS) ? TFT_SPI_BURST_PIXELS : Copy_Count;
+        SPI_voidStream(Copy_Bus->TFT_Spi, Copy_Burst, (u16)(Local_Chunk * Copy_PixelBytes));
+        Copy_Count -= Local_Chunk;
+    }
+
+    TFT_SpiRelease(Copy_Bus);
+}
@@ -0,0 +1,20 @@
+/**
+ ********************************************************************************************
+ * @file CAL_config.h
+ * @brief This file contains the configuration of the calendar service.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __CAL_CONFIG_H__
+#define __CAL_CONFIG_H__
+
+/**
+ * @brief The offset of the local time from UTC in seconds (e.g. 7200 for UTC+2).
+ */
+#define CAL_UTC_OFFSET              0
+
+#endif /**< __CAL_CONFIG_H__ */
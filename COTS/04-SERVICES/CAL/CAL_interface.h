@@ -0,0 +1,88 @@
+/**
+ ********************************************************************************************
+ * @file CAL_interface.h
+ * @brief This file contains the interface of the calendar service.
+ *
+ * The RTC counter holds the Unix time (seconds since 1970-01-01 00:00:00 UTC). The conversions between the Unix time
+ * and the calendar date are done in constant time, with a few divisions by constants and no loop over years or months.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __CAL_INTERFACE_H__
+#define __CAL_INTERFACE_H__
+
+/**
+ * @addtogroup CAL_Types
+ * @{
+ */
+
+/**
+ * @brief Calendar date and time.
+ */
+typedef struct
+{
+    u16 Year;       /**< 1970 to 2105 */
+    u8 Month;       /**< 1 to 12 */
+    u8 Day;         /**< 1 to 31 */
+    u8 Hour;        /**< 0 to 23 */
+    u8 Minute;      /**< 0 to 59 */
+    u8 Second;      /**< 0 to 59 */
+    u8 WeekDay;     /**< 0 (Sunday) to 6 (Saturday), ignored when setting */
+} CAL_DateTime_t;
+
+/** @} CAL_Types */
+
+/**
+ * @addtogroup CAL_Functions
+ * @{
+ */
+
+/**
+ * @brief Converts a Unix time to a calendar date.
+ *
+ * @param[in] Copy_Epoch The seconds since 1970-01-01 00:00:00.
+ * @param[out] Copy_DateTime Returns the date and time.
+ * @retval None
+ */
+void CAL_EpochToDate(u32 Copy_Epoch, CAL_DateTime_t *Copy_DateTime);
+
+/**
+ * @brief Converts a calendar date to a Unix time.
+ *
+ * @param[in] Copy_DateTime The date and time, not checked.
+ * @return The seconds since 1970-01-01 00:00:00.
+ */
+u32 CAL_DateToEpoch(const CAL_DateTime_t *Copy_DateTime);
+
+/**
+ * @brief Gets the local date and time from the RTC.
+ *
+ * @param[out] Copy_DateTime Returns the date and time.
+ * @retval None
+ */
+void CAL_GetDateTime(CAL_DateTime_t *Copy_DateTime);
+
+/**
+ * @brief Sets the RTC from a local date and time.
+ *
+ * @param[in] Copy_DateTime The date and time.
+ * @return E_OK, or E_NOT_OK when the date is out of range or the day does not exist in the month.
+ */
+Std_ReturnType CAL_SetDateTime(const CAL_DateTime_t *Copy_DateTime);
+
+/**
+ * @brief Gets a millisecond timestamp from the RTC.
+ *
+ * Unlike the SysTick time base it keeps counting across resets and while the SysTick is stopped.
+ *
+ * @return The milliseconds since 1970-01-01 00:00:00 UTC.
+ */
+u64 CAL_GetEpochMs(void);
+
+/** @} CAL_Functions */
+
+#endif /**< __CAL_INTERFACE_H__ */
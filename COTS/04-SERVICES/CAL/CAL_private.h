@@ -0,0 +1,37 @@
+/**
+ ********************************************************************************************
+ * @file CAL_private.h
+ * @brief This file contains the private definitions of the calendar service.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __CAL_PRIVATE_H__
+#define __CAL_PRIVATE_H__
+
+#define CAL_SECONDS_PER_DAY         86400UL
+
+/**
+ * @brief The conversions count days from 0000-03-01 in the proleptic Gregorian calendar, in eras of 400 years.
+ * The year starts in March so the leap day is the last day of the year.
+ */
+#define CAL_DAYS_PER_ERA            146097UL
+#define CAL_EPOCH_DAYS              719468UL    /**< Days from 0000-03-01 to 1970-01-01 */
+#define CAL_EPOCH_WEEKDAY           4           /**< 1970-01-01 was a Thursday */
+
+#define CAL_YEAR_MIN                1970
+#define CAL_YEAR_MAX                2105
+
+/**
+ * @brief Returns the number of days in a month.
+ *
+ * @param Copy_Year The year, used for February.
+ * @param Copy_Month The month, 1 to 12.
+ * @return 28 to 31.
+ */
+static u8 CAL_DaysInMonth(u16 Copy_Year, u8 Copy_Month);
+
+#endif /**< __CAL_PRIVATE_H__ */
@@ -0,0 +1,135 @@
+/**
+ ********************************************************************************************
+ * @file CAL_program.c
+ * @brief This file contains the implementation of the calendar service.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "RTC_interface.h"
+/**< SERVICES */
+#include "CAL_interface.h"
+#include "CAL_config.h"
+#include "CAL_private.h"
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void CAL_EpochToDate(u32 Copy_Epoch, CAL_DateTime_t *Copy_DateTime)
+{
+    u32 Local_Days = Copy_Epoch / CAL_SECONDS_PER_DAY;
+    u32 Local_Seconds = Copy_Epoch - (Local_Days * CAL_SECONDS_PER_DAY);
+    u32 Local_Shifted;
+    u32 Local_Era;
+    u32 Local_DayOfEra;
+    u32 Local_YearOfEra;
+    u32 Local_DayOfYear;
+    u32 Local_MonthIndex;
+
+    if (Copy_DateTime == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    Copy_DateTime->Hour = (u8)(Local_Seconds / 3600);
+    Local_Seconds -= Copy_DateTime->Hour * 3600UL;
+    Copy_DateTime->Minute = (u8)(Local_Seconds / 60);
+    Copy_DateTime->Second = (u8)(Local_Seconds - (Copy_DateTime->Minute * 60UL));
+    Copy_DateTime->WeekDay = (u8)((Local_Days + CAL_EPOCH_WEEKDAY) % 7);
+
+    Local_Shifted = Local_Days + CAL_EPOCH_DAYS;
+    Local_Era = Local_Shifted / CAL_DAYS_PER_ERA;
+    Local_DayOfEra = Local_Shifted - (Local_Era * CAL_DAYS_PER_ERA);
+
+    /**< Removes the leap days (every 4 years, not 100, every 400) before dividing by 365 */
+    Local_YearOfEra = (Local_DayOfEra - (Local_DayOfEra / 1460) + (Local_DayOfEra / 36524) - (Local_DayOfEra / 146096)) / 365;
+    Local_DayOfYear = Local_DayOfEra - ((365 * Local_YearOfEra) + (Local_YearOfEra / 4) - (Local_YearOfEra / 100));
+
+    /**< From March, the month lengths repeat every 5 months (153 days) */
+    Local_MonthIndex = ((5 * Local_DayOfYear) + 2) / 153;
+    Copy_DateTime->Day = (u8)(Local_DayOfYear - (((153 * Local_MonthIndex) + 2) / 5) + 1);
+    Copy_DateTime->Month = (u8)((Local_MonthIndex < 10) ? (Local_MonthIndex + 3) : (Local_MonthIndex - 9));
+    Copy_DateTime->Year = (u16)(Local_YearOfEra + (Local_Era * 400) + (Copy_DateTime->Month <= 2));
+}
+
+u32 CAL_DateToEpoch(const CAL_DateTime_t *Copy_DateTime)
+{
+    u32 Local_Year;
+    u32 Local_MonthIndex;
+    u32 Local_Era;
+    u32 Local_YearOfEra;
+    u32 Local_DayOfEra;
+    u32 Local_Days;
+
+    if (Copy_DateTime == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return 0;
+    }
+
+    /**< January and February count as the months 10 and 11 of the previous year */
+    Local_Year = Copy_DateTime->Year - (Copy_DateTime->Month <= 2);
+    Local_MonthIndex = (Copy_DateTime->Month > 2) ? (Copy_DateTime->Month - 3) : (Copy_DateTime->Month + 9);
+    Local_Era = Local_Year / 400;
+    Local_YearOfEra = Local_Year - (Local_Era * 400);
+    Local_DayOfEra = (365 * Local_YearOfEra) + (Local_YearOfEra / 4) - (Local_YearOfEra / 100)
+                     + ((((153 * Local_MonthIndex) + 2) / 5) + Copy_DateTime->Day - 1);
+    Local_Days = (Local_Era * CAL_DAYS_PER_ERA) + Local_DayOfEra - CAL_EPOCH_DAYS;
+
+    return (Local_Days * CAL_SECONDS_PER_DAY) + (Copy_DateTime->Hour * 3600UL) + (Copy_DateTime->Minute * 60UL)
+           + Copy_DateTime->Second;
+}
+
+void CAL_GetDateTime(CAL_DateTime_t *Copy_DateTime)
+{
+    CAL_EpochToDate(RTC_GetCounter() + CAL_UTC_OFFSET, Copy_DateTime);
+}
+
+Std_ReturnType CAL_SetDateTime(const CAL_DateTime_t *Copy_DateTime)
+{
+    if ((Copy_DateTime == NULL) || (Copy_DateTime->Year < CAL_YEAR_MIN) || (Copy_DateTime->Year > CAL_YEAR_MAX)
+        || (Copy_DateTime->Month < 1) || (Copy_DateTime->Month > 12) || (Copy_DateTime->Day < 1)
+        || (Copy_DateTime->Day > CAL_DaysInMonth(Copy_DateTime->Year, Copy_DateTime->Month))
+        || (Copy_DateTime->Hour > 23) || (Copy_DateTime->Minute > 59)
+        || (Copy_DateTime->Second > 59))
+    {
+        return E_NOT_OK;
+    }
+
+    RTC_SetCounter(CAL_DateToEpoch(Copy_DateTime) - CAL_UTC_OFFSET);
+
+    return E_OK;
+}
+
+u64 CAL_GetEpochMs(void)
+{
+    u32 Local_Seconds;
+    u16 Local_Subseconds;
+
+    RTC_GetTimestamp(&Local_Seconds, &Local_Subseconds);
+
+    return ((u64)Local_Seconds * 1000) + RTC_SUBSECONDS_TO_MS(Local_Subseconds);
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static u8 CAL_DaysInMonth(u16 Copy_Year, u8 Copy_Month)
+{
+    u32 Local_MonthIndex;
+
+    if (Copy_Month == 2)
+    {
+        /**< The leap day is kept in February, every 4 years except the centuries not divisible by 400 */
+        return (((Copy_Year % 4) == 0) && (((Copy_Year % 100) != 0) || ((Copy_Year % 400) == 0))) ? 29 : 28;
+    }
+
+    /**< From March to January, a month length is the difference between two month starts of the 153-day cycle */
+    Local_MonthIndex = (Copy_Month > 2) ? (Copy_Month - 3) : (Copy_Month + 9);
+
+    return (u8)((((153 * (Local_MonthIndex + 1)) + 2) / 5) - (((153 * Local_MonthIndex) + 2) / 5));
+}
@@ -0,0 +1,24 @@
+/**
+ * @file FONT_config.h
+ * @brief This file contains the configuration options for the font service.
+ *
+ * Application code can modify the values in this file to customize the behavior of the font service.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 19 Oct 2026
+ * @version V01
+ * 
+ */
+#ifndef __FONT_CONFIG_H__
+#define __FONT_CONFIG_H__
+
+/**
+ * @brief The character drawn in place of codes that have no glyph in the table.
+ *
+ * Must be in the range FONT_5X7_FIRST_CHAR .. FONT_5X7_LAST_CHAR.
+ */
+#define FONT_REPLACEMENT_CHAR    '?'
+
+
+
+#endif /**< __FONT_CONFIG_H__ */
@@ -0,0 +1,38 @@
+/**
+ * @file FONT_interface.h
+ * @brief This file contains the public interface of the font service.
+ *
+ * The font service provides the glyph bitmaps used by the display drivers to render text.
+ * Glyphs are stored column by column, one byte per column with bit 0 at the top row, which is
+ * the native layout of both the LED matrix rows and the TFT text renderers.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 19 Oct 2026
+ * @version V01
+ * 
+ */
+#ifndef __FONT_INTERFACE_H__
+#define __FONT_INTERFACE_H__
+
+/**
+ * @brief Geometry of the built-in 5x7 font.
+ */
+#define FONT_5X7_WIDTH              5       /**< Number of glyph columns (bytes per glyph) */
+#define FONT_5X7_HEIGHT             7       /**< Number of used rows (bits 0..6 of each column) */
+#define FONT_5X7_FIRST_CHAR         0x20    /**< First printable character in the table (space) */
+#define FONT_5X7_LAST_CHAR          0x7E    /**< Last printable character in the table (~) */
+
+/**
+ * @brief Gets the column bitmap of a character in the 5x7 font.
+ *
+ * This function returns a pointer to the FONT_5X7_WIDTH column bytes of the requested character.
+ * Bit n of each byte is the pixel at row n of the glyph. Characters outside the printable ASCII
+ * range are replaced with FONT_REPLACEMENT_CHAR.
+ *
+ * @param[in]  Copy_Character   The ASCII code of the character.
+ *
+ * @retval     Pointer to the FONT_5X7_WIDTH column bytes of the glyph (never NULL).
+ */
+const u8 *FONT_GetGlyph5x7(u8 Copy_Character);
+
+#endif /**< __FONT_INTERFACE_H__ */
@@ -0,0 +1,26 @@
+/**
+ * @file FONT_program.c
+ * @brief This file contains the implementation of the font service.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 19 Oct 2026
+ * @version V01
+ * 
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< SERVICES */
+#include "FONT_config.h"
+#include "FONT_interface.h"
+#include "FONT_private.h"
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+const u8 *FONT_GetGlyph5x7(u8 Copy_Character)
+{
+    if((Copy_Character < FONT_5X7_FIRST_CHAR) || (Copy_Character > FONT_5X7_LAST_CHAR))
+    {
+        Copy_Character = FONT_REPLACEMENT_CHAR;
+    }
+
+    return FONT_Glyphs5x7[Copy_Character - FONT_5X7_FIRST_CHAR];
+}
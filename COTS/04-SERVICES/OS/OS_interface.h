@@ -20,6 +20,7 @@
  * @brief Creates a new task in the operating system.
  *
  * This function creates a new task with the given priority, periodicity, task function, and first delay.
+ * After OS_Start() the first delay counts from the current tick, the scheduler is woken earlier when needed.
  *
  * @param[in]  Copy_u8TaskPriority      The priority of the new task.
  * @param[in]  Copy_u16TaskPeriodicity  The periodicity of the new task in milliseconds.
@@ -34,8 +35,12 @@ u8 OS_CreateTask(u8 Copy_u8TaskPriority, u16 Copy_u16TaskPeriodicity, void (*Cop
 /**
  * @brief Starts the operating system scheduler.
  *
- * This function initializes the system tick timer and starts the operating system scheduler.
+ * This function starts the operating system scheduler on a software timer of the TMR service.
  * The scheduler runs the task functions for each registered task at the appropriate times.
+ * The timer only expires on the ticks where a task runs, so with the tickless idle of TMR the core
+ * sleeps between the tasks.
+ *
+ * @note TMR_Init() must be called before, and the application idle loop calls TMR_Idle().
  *
  * @param[in]  None
  * @param[out] None
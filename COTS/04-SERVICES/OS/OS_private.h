@@ -21,7 +21,7 @@
 typedef struct {
     u16 Periodicity;                /**< The periodicity of the task in microsecond. */
     void (*OS_pfSetTask)(void);     /**< A pointer to the function that implements the task. */
-    u8 FirstDelay;                  /**< The initial delay of the task in ticks. */
+    u16 FirstDelay;                 /**< The ticks left before the next run of the task. */
     /**< The current state of the task's scheduler. */
 } OS_Task_t;
 
@@ -31,20 +31,57 @@ typedef struct {
  * This array holds the registered tasks for the operating system. Each task is represented
  * by a "SOS_Task_t" structure.
  */
-static OS_Task_t OS_Tasks[OS_NUMBER_TASKS] = {NULL};
+static OS_Task_t OS_Tasks[OS_NUMBER_TASKS] = {0};
+
+/**
+ * @brief The number of software timer ticks in an OS tick.
+ */
+#define OS_TMR_TICKS        (OS_TICK_TIME / TMR_TICK_US)
+
+#if (OS_TICK_TIME % TMR_TICK_US) != 0
+    #error "The OS tick must be a multiple of the software timers tick"
+#endif
+
+/**
+ * @brief The number of OS ticks slept when no task is created.
+ */
+#define OS_IDLE_STEP        0x10000UL
+
+/**
+ * @brief The software timer running the scheduler, and the number of OS ticks it was armed for.
+ */
+static TMR_Timer_t OS_Timer;
+static u32 OS_Step;
+
+/**
+ * @brief Critical section saving and restoring PRIMASK, the scheduler runs from the tick interrupt.
+ */
+#define OS_ENTER_CRITICAL(STATE)    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (STATE) : : "memory")
+#define OS_EXIT_CRITICAL(STATE)     __asm volatile ("msr primask, %0" : : "r" (STATE) : "memory")
 
 
 /**
  * @brief The scheduler function for the operating system.
  *
  * This function runs the task functions for each registered task at the appropriate times.
+ * It is the callback of the scheduler software timer, which expires on the tick of the next task to run.
  *
- * @param[in]  None
+ * @param[in]  Copy_Context Not used.
  * @param[out] None
  *
  * @retval     None
  */
-static void OS_SetScheduler(void);
+static void OS_SetScheduler(void *Copy_Context);
+
+/**
+ * @brief Gets the number of OS ticks until the next task to run.
+ *
+ * @param[in]  None
+ * @param[out] None
+ *
+ * @return     The number of OS ticks, OS_IDLE_STEP when no task is created.
+ */
+static u32 OS_GetNextStep(void);
 
 
 
@@ -10,9 +10,9 @@
 /**< LIB */
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
-/**< MCAL */
-#include "STK_interface.h"
 /**< SERVICES */
+#include "TMR_interface.h"
+#include "TMR_config.h"
 #include "OS_config.h"
 #include "OS_interface.h"
 #include "OS_private.h"
@@ -20,12 +20,45 @@
 u8 OS_CreateTask(u8 Copy_u8TaskPriority, u16 Copy_u16TaskPeriodicity, void (*Copy_pfTask)(void), u8 Copy_u8FirstDelay)
 {
     u8 Local_u8ErrorStatus = 0;
+    u32 Local_u32State;
+    u32 Local_u32Elapsed;
+    u32 Local_u32Deadline;
 
     if(Copy_pfTask != NULL)
     {
+        OS_ENTER_CRITICAL(Local_u32State);
+
         OS_Tasks[Copy_u8TaskPriority].Periodicity = Copy_u16TaskPeriodicity;
         OS_Tasks[Copy_u8TaskPriority].OS_pfSetTask = Copy_pfTask;
         OS_Tasks[Copy_u8TaskPriority].FirstDelay = Copy_u8FirstDelay;
+
+        if (TMR_IsRunning(&OS_Timer))
+        {
+            /**< The delays count from the start of the running step, the software timer ticks of it that passed */
+            Local_u32Elapsed = (OS_Step * OS_TMR_TICKS) - TMR_GetRemainingTicks(&OS_Timer);
+            Local_u32Deadline = (Local_u32Elapsed / OS_TMR_TICKS) + Copy_u8FirstDelay;
+
+            if (Local_u32Deadline < (OS_Step - 1))
+            {
+                /**< Due before the end of the step: a new step starts on the current OS tick */
+                for (u8 Local_u8Count = 0; Local_u8Count < OS_NUMBER_TASKS; Local_u8Count++)
+                {
+                    if ((Local_u8Count != Copy_u8TaskPriority) && (OS_Tasks[Local_u8Count].OS_pfSetTask != NULL))
+                    {
+                        OS_Tasks[Local_u8Count].FirstDelay -= (u16)(Local_u32Elapsed / OS_TMR_TICKS);
+                    }
+                }
+
+                OS_Step = OS_GetNextStep();
+                TMR_Start(&OS_Timer, (OS_Step * OS_TMR_TICKS) - (Local_u32Elapsed % OS_TMR_TICKS), 0, OS_SetScheduler, NULL);
+            }
+            else
+            {
+                OS_Tasks[Copy_u8TaskPriority].FirstDelay = (Local_u32Deadline > 0xFFFF) ? 0xFFFF : (u16)Local_u32Deadline;
+            }
+        }
+
+        OS_EXIT_CRITICAL(Local_u32State);
     }
     else
     {
@@ -36,27 +69,49 @@ u8 OS_CreateTask(u8 Copy_u8TaskPriority, u16 Copy_u16TaskPeriodicity, void (*Cop
 }
 void OS_Start(void)
 {
-    /*****************************< Initialization *****************************/
-    STK_Init();
-    /**< Set the Tick time to be ===> 1msec */
-    MSTK_voidSetIntervalPeriodic(OS_TICK_TIME, OS_SetScheduler);
+    /**< The scheduler runs on the tick of the next task only, the ticks in between are free to sleep */
+    OS_Step = OS_GetNextStep();
+    TMR_Start(&OS_Timer, OS_Step * OS_TMR_TICKS, 0, OS_SetScheduler, NULL);
 }
 
-static void OS_SetScheduler(void)
+static void OS_SetScheduler(void *Copy_Context)
 {
+    (void)Copy_Context;
+
+    /**< OS_Step ticks passed, the tasks due on the last one run */
     for (u8 Local_u8Count = 0; Local_u8Count < OS_NUMBER_TASKS;Local_u8Count++)
     {
         if(OS_Tasks[Local_u8Count].OS_pfSetTask != NULL)
         {
-            if(OS_Tasks[Local_u8Count].FirstDelay == 0)
+            /**< A task due earlier than the last tick runs late rather than wrapping its counter */
+            if(OS_Tasks[Local_u8Count].FirstDelay <= (OS_Step - 1))
             {
                 OS_Tasks[Local_u8Count].FirstDelay = ((OS_Tasks[Local_u8Count].Periodicity)-1);
                 OS_Tasks[Local_u8Count].OS_pfSetTask();
             }
             else
             {
-                OS_Tasks[Local_u8Count].FirstDelay--;
+                OS_Tasks[Local_u8Count].FirstDelay -= OS_Step;
             }
         }
     }
+
+    /**< Armed from the expiry tick, the periods do not drift */
+    OS_Step = OS_GetNextStep();
+    TMR_Start(&OS_Timer, OS_Step * OS_TMR_TICKS, 0, OS_SetScheduler, NULL);
+}
+
+static u32 OS_GetNextStep(void)
+{
+    u32 Local_u32Step = OS_IDLE_STEP;
+
+    for (u8 Local_u8Count = 0; Local_u8Count < OS_NUMBER_TASKS;Local_u8Count++)
+    {
+        if((OS_Tasks[Local_u8Count].OS_pfSetTask != NULL) && ((u32)OS_Tasks[Local_u8Count].FirstDelay + 1 < Local_u32Step))
+        {
+            Local_u32Step = (u32)OS_Tasks[Local_u8Count].FirstDelay + 1;
+        }
+    }
+
+    return Local_u32Step;
 }
@@ -0,0 +1,36 @@
+/**
+ ********************************************************************************************
+ * @file SPWM_config.h
+ * @brief This file contains the configuration of the software PWM service.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __SPWM_CONFIG_H__
+#define __SPWM_CONFIG_H__
+
+/**
+ * @brief The timer and its compare channel (no output pin is used).
+ */
+#define SPWM_TIMER                  TIM3
+#define SPWM_TIMER_CHANNEL          TIM_CHANNEL1
+
+/**
+ * @brief The PWM frequency in Hz and the number of duty steps of a period, at most 65536.
+ *
+ * A step must last longer than the interrupt (100 Hz x 256 steps: 39 us per step).
+ */
+#define SPWM_FREQUENCY_HZ           100
+#define SPWM_RESOLUTION             256
+
+/**
+ * @brief The pins of the channels, {port, pin} each.
+ */
+#define SPWM_NUM_CHANNELS           8
+#define SPWM_CHANNEL_PINS           { {GPIO_PORTA, 8}, {GPIO_PORTA, 9}, {GPIO_PORTA, 10}, {GPIO_PORTA, 11}, \
+                                      {GPIO_PORTB, 12}, {GPIO_PORTB, 13}, {GPIO_PORTB, 14}, {GPIO_PORTB, 15} }
+
+#endif /**< __SPWM_CONFIG_H__ */
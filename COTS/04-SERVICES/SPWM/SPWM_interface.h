@@ -0,0 +1,62 @@
+/**
+ ********************************************************************************************
+ * @file SPWM_interface.h
+ * @brief This file contains the interface of the software PWM service.
+ *
+ * Any GPIO output pins get a PWM from one compare channel of a general purpose timer. The duty cycles are compiled
+ * into a table of edges sorted by time, each edge holding one set/reset word per port. The timer interrupt comes
+ * once per distinct edge time and writes each port BSRR once, the cost does not depend on the number of pins.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __SPWM_INTERFACE_H__
+#define __SPWM_INTERFACE_H__
+
+/**
+ * @addtogroup SPWM_Functions
+ * @{
+ */
+
+/**
+ * @brief Initializes the pins as outputs (low) and starts the timer.
+ *
+ * @note The timer clock (RCC) and its NVIC line are enabled by the application.
+ *
+ * @retval None
+ */
+void SPWM_Init(void);
+
+/**
+ * @brief Sets the duty cycle of a channel, applied by SPWM_Update().
+ *
+ * @param[in] Copy_Channel The channel, index in SPWM_CHANNEL_PINS.
+ * @param[in] Copy_Duty The number of high steps of a period, 0 (off) to SPWM_RESOLUTION (on).
+ * @retval None
+ */
+void SPWM_SetDuty(u8 Copy_Channel, u16 Copy_Duty);
+
+/**
+ * @brief Gets the duty cycle of a channel as last set.
+ *
+ * @param[in] Copy_Channel The channel.
+ * @return The duty cycle in steps.
+ */
+u16 SPWM_GetDuty(u8 Copy_Channel);
+
+/**
+ * @brief Rebuilds the edge table from the duty cycles, used from the next period.
+ *
+ * Several SPWM_SetDuty() calls are applied together, all the pins change on the same period boundary. When the previous
+ * update is not applied yet it waits for it, at most one period.
+ *
+ * @retval None
+ */
+void SPWM_Update(void);
+
+/** @} SPWM_Functions */
+
+#endif /**< __SPWM_INTERFACE_H__ */
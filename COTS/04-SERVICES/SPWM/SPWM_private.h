@@ -0,0 +1,68 @@
+/**
+ ********************************************************************************************
+ * @file SPWM_private.h
+ * @brief This file contains the private definitions of the software PWM service.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __SPWM_PRIVATE_H__
+#define __SPWM_PRIVATE_H__
+
+/**
+ * @brief The GPIO ports, GPIO_PORTA to GPIO_PORTC.
+ */
+#define SPWM_NUM_PORTS              3
+
+/**
+ * @brief The edges of a period: one at time 0 that sets the pins, one per distinct duty that resets them.
+ */
+#define SPWM_MAX_EVENTS             (SPWM_NUM_CHANNELS + 1)
+
+#if (SPWM_RESOLUTION < 2) || (SPWM_RESOLUTION > 65536)
+    #error "The software PWM resolution is 2 to 65536 steps"
+#endif
+
+/**
+ * @brief A channel pin.
+ */
+typedef struct
+{
+    u8 Port;
+    u8 Pin;
+} SPWM_Pin_t;
+
+/**
+ * @brief An edge: its time in the period and the BSRR word of each port, 0 when the port does not change.
+ */
+typedef struct
+{
+    u16 Time;
+    u32 Bsrr[SPWM_NUM_PORTS];
+} SPWM_Event_t;
+
+/**
+ * @brief The edges of a period sorted by time.
+ */
+typedef struct
+{
+    SPWM_Event_t Events[SPWM_MAX_EVENTS];
+    u8 Count;
+} SPWM_Table_t;
+
+/**
+ * @brief Compiles the duty cycles into an edge table.
+ *
+ * @param Copy_Table Pointer to the table.
+ */
+static void SPWM_BuildTable(SPWM_Table_t *Copy_Table);
+
+/**
+ * @brief Compare interrupt: applies the due edges and schedules the next one.
+ */
+static void SPWM_HandleEvent(void);
+
+#endif /**< __SPWM_PRIVATE_H__ */
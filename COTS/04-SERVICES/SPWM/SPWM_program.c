@@ -0,0 +1,189 @@
+/**
+ ********************************************************************************************
+ * @file SPWM_program.c
+ * @brief This file contains the implementation of the software PWM service.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "RCC_interface.h"
+#include "GPIO_interface.h"
+#include "TIM_interface.h"
+/**< SERVICES */
+#include "SPWM_interface.h"
+#include "SPWM_config.h"
+#include "SPWM_private.h"
+
+static const SPWM_Pin_t SPWM_Pins[SPWM_NUM_CHANNELS] = SPWM_CHANNEL_PINS;
+
+/**< Duty cycles as set, compiled by SPWM_Update() */
+static u16 SPWM_Duty[SPWM_NUM_CHANNELS] = {0};
+
+/**< The interrupt runs the front table, SPWM_Update() builds the other one and asks for the swap */
+static SPWM_Table_t SPWM_Tables[2];
+static volatile u8 SPWM_FrontIndex = 0;
+static volatile u8 SPWM_SwapPending = 0;
+
+/**< Next edge of the front table */
+static u8 SPWM_EventIndex = 0;
+
+/**< BSRR of each port */
+static volatile u32 *SPWM_Bsrr[SPWM_NUM_PORTS];
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void SPWM_Init(void)
+{
+    for (u8 Local_Port = 0; Local_Port < SPWM_NUM_PORTS; Local_Port++)
+    {
+        SPWM_Bsrr[Local_Port] = GPIO_GetSetResetRegister(Local_Port);
+    }
+
+    for (u8 Local_Channel = 0; Local_Channel < SPWM_NUM_CHANNELS; Local_Channel++)
+    {
+        GPIO_SetPinMode(SPWM_Pins[Local_Channel].Port, SPWM_Pins[Local_Channel].Pin, GPIO_OUTPUT_PP_2MHZ);
+        GPIO_SetPinValue(SPWM_Pins[Local_Channel].Port, SPWM_Pins[Local_Channel].Pin, GPIO_LOW);
+        SPWM_Duty[Local_Channel] = 0;
+    }
+
+    SPWM_BuildTable(&SPWM_Tables[0]);
+    SPWM_FrontIndex = 0;
+    SPWM_SwapPending = 0;
+    SPWM_EventIndex = 0;
+
+    /**< A period of SPWM_RESOLUTION steps, the first edge on the first count */
+    TIM_Init(SPWM_TIMER, RCC_GetAPB1TimerClockFreq() / ((u32)SPWM_FREQUENCY_HZ * SPWM_RESOLUTION), SPWM_RESOLUTION);
+    TIM_SetOutputCompare(SPWM_TIMER, SPWM_TIMER_CHANNEL, 0, SPWM_HandleEvent);
+    TIM_Start(SPWM_TIMER);
+}
+
+void SPWM_SetDuty(u8 Copy_Channel, u16 Copy_Duty)
+{
+    if (Copy_Channel >= SPWM_NUM_CHANNELS)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    SPWM_Duty[Copy_Channel] = (Copy_Duty > SPWM_RESOLUTION) ? SPWM_RESOLUTION : Copy_Duty;
+}
+
+u16 SPWM_GetDuty(u8 Copy_Channel)
+{
+    return (Copy_Channel < SPWM_NUM_CHANNELS) ? SPWM_Duty[Copy_Channel] : 0;
+}
+
+void SPWM_Update(void)
+{
+    /**< The back table is free once the previous update is swapped in */
+    while (SPWM_SwapPending);
+
+    SPWM_BuildTable(&SPWM_Tables[SPWM_FrontIndex ^ 1]);
+    SPWM_SwapPending = 1;
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void SPWM_BuildTable(SPWM_Table_t *Copy_Table)
+{
+    u8 Local_Order[SPWM_NUM_CHANNELS];
+    u8 Local_Channel;
+    u8 Local_Position;
+    SPWM_Event_t *Local_Event = &Copy_Table->Events[0];
+
+    /**< Channels by increasing duty, insertion sort (a few channels, mostly sorted from the last build) */
+    for (u8 Local_Iterator = 0; Local_Iterator < SPWM_NUM_CHANNELS; Local_Iterator++)
+    {
+        Local_Position = Local_Iterator;
+        while ((Local_Position > 0) && (SPWM_Duty[Local_Order[Local_Position - 1]] > SPWM_Duty[Local_Iterator]))
+        {
+            Local_Order[Local_Position] = Local_Order[Local_Position - 1];
+            Local_Position--;
+        }
+        Local_Order[Local_Position] = Local_Iterator;
+    }
+
+    /**< Time 0 sets the pins that are not off, and keeps the others reset */
+    Local_Event->Time = 0;
+    for (u8 Local_Port = 0; Local_Port < SPWM_NUM_PORTS; Local_Port++)
+    {
+        Local_Event->Bsrr[Local_Port] = 0;
+    }
+    for (Local_Channel = 0; Local_Channel < SPWM_NUM_CHANNELS; Local_Channel++)
+    {
+        if (SPWM_Duty[Local_Channel] != 0)
+        {
+            Local_Event->Bsrr[SPWM_Pins[Local_Channel].Port] |= (u32)1 << SPWM_Pins[Local_Channel].Pin;
+        }
+        else
+        {
+            Local_Event->Bsrr[SPWM_Pins[Local_Channel].Port] |= (u32)1 << (SPWM_Pins[Local_Channel].Pin + 16);
+        }
+    }
+    Copy_Table->Count = 1;
+
+    /**< One reset edge per distinct duty, the channels always on have none */
+    for (u8 Local_Iterator = 0; Local_Iterator < SPWM_NUM_CHANNELS; Local_Iterator++)
+    {
+        Local_Channel = Local_Order[Local_Iterator];
+
+        if ((SPWM_Duty[Local_Channel] == 0) || (SPWM_Duty[Local_Channel] >= SPWM_RESOLUTION))
+        {
+            continue;
+        }
+
+        if (Local_Event->Time != SPWM_Duty[Local_Channel])
+        {
+            Local_Event = &Copy_Table->Events[Copy_Table->Count];
+            Copy_Table->Count++;
+            Local_Event->Time = SPWM_Duty[Local_Channel];
+            for (u8 Local_Port = 0; Local_Port < SPWM_NUM_PORTS; Local_Port++)
+            {
+                Local_Event->Bsrr[Local_Port] = 0;
+            }
+        }
+        Local_Event->Bsrr[SPWM_Pins[Local_Channel].Port] |= (u32)1 << (SPWM_Pins[Local_Channel].Pin + 16);
+    }
+}
+
+static void SPWM_HandleEvent(void)
+{
+    const SPWM_Table_t *Local_Table = &SPWM_Tables[SPWM_FrontIndex];
+    const SPWM_Event_t *Local_Event;
+
+    do
+    {
+        /**< One store per port that changes on this edge */
+        Local_Event = &Local_Table->Events[SPWM_EventIndex];
+        for (u8 Local_Port = 0; Local_Port < SPWM_NUM_PORTS; Local_Port++)
+        {
+            if (Local_Event->Bsrr[Local_Port] != 0)
+            {
+                *SPWM_Bsrr[Local_Port] = Local_Event->Bsrr[Local_Port];
+            }
+        }
+
+        SPWM_EventIndex++;
+        if (SPWM_EventIndex >= Local_Table->Count)
+        {
+            /**< End of the period: the next edge is time 0, of the new table when an update is pending */
+            SPWM_EventIndex = 0;
+            if (SPWM_SwapPending)
+            {
+                SPWM_FrontIndex ^= 1;
+                SPWM_SwapPending = 0;
+                Local_Table = &SPWM_Tables[SPWM_FrontIndex];
+            }
+            break;
+        }
+
+        /**< An edge already passed (two edges closer than the interrupt) is applied now, not a period late */
+    } while (Local_Table->Events[SPWM_EventIndex].Time <= TIM_GetCounter(SPWM_TIMER));
+
+    TIM_SetCompare(SPWM_TIMER, SPWM_TIMER_CHANNEL, Local_Table->Events[SPWM_EventIndex].Time);
+}
@@ -0,0 +1,43 @@
+/**
+ ********************************************************************************************
+ * @file TMR_config.h
+ * @brief This file contains the configuration options of the software timers service.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TMR_CONFIG_H__
+#define __TMR_CONFIG_H__
+
+/**
+ * @brief The tick period in microseconds, the resolution of the timers.
+ */
+#define TMR_TICK_US                 1000
+
+/**
+ * @brief The tick source of the service.
+ *
+ * Available options:
+ * - TMR_TICK_SOURCE_STK: TMR_Init() programs the SysTick periodic interval.
+ * - TMR_TICK_SOURCE_EXTERNAL: The application calls TMR_Tick() every TMR_TICK_US.
+ */
+#define TMR_TICK_SOURCE             TMR_TICK_SOURCE_STK
+
+/**
+ * @brief Tickless idle, only with TMR_TICK_SOURCE_STK.
+ *
+ * Available options:
+ * - TMR_TICKLESS_IDLE_ENABLE: TMR_Idle() skips the ticks that have nothing to do.
+ * - TMR_TICKLESS_IDLE_DISABLE: TMR_Idle() only waits for the next interrupt, every tick wakes the core.
+ */
+#define TMR_TICKLESS_IDLE           TMR_TICKLESS_IDLE_ENABLE
+
+/**
+ * @brief The minimum number of ticks worth skipping, shorter idle periods keep the ticks.
+ */
+#define TMR_TICKLESS_MIN_TICKS      2
+
+#endif /**< __TMR_CONFIG_H__ */
@@ -0,0 +1,144 @@
+/**
+ ********************************************************************************************
+ * @file TMR_interface.h
+ * @brief This file contains the interface of the software timers service.
+ *
+ * Any number of one-shot and periodic software timers share one tick. The timers are kept in a hierarchical
+ * timer wheel: starting and stopping a timer is a constant time list operation and each tick only visits the
+ * timers expiring on it, plus an occasional cascade of a slot of the upper levels.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TMR_INTERFACE_H__
+#define __TMR_INTERFACE_H__
+
+/**
+ * @addtogroup TMR_Types
+ * @{
+ */
+
+/**
+ * @brief Link of a timer in a wheel slot list.
+ */
+typedef struct TMR_Link_t
+{
+    struct TMR_Link_t *Next;    /**< Next link, NULL when the timer is not running */
+    struct TMR_Link_t *Prev;    /**< Previous link */
+} TMR_Link_t;
+
+/**
+ * @brief A software timer.
+ *
+ * The application allocates the timers (statically, in a driver state, ...), the service only links them.
+ * The fields are private to the service, a timer must not be changed or freed while it runs.
+ */
+typedef struct
+{
+    TMR_Link_t Link;                            /**< Must stay the first member */
+    void (*Callback)(void *Copy_Context);       /**< Called on expiry */
+    void *Context;                              /**< Passed to the callback */
+    u32 Expiry;                                 /**< Tick of the next expiry */
+    u32 Period;                                 /**< Ticks between two expiries, 0 for a one-shot timer */
+} TMR_Timer_t;
+
+/**
+ * @brief Converts milliseconds to ticks, rounding up.
+ */
+#define TMR_MS_TO_TICKS(MS)         ((u32)((((u32)(MS) * 1000UL) + TMR_TICK_US - 1) / TMR_TICK_US))
+
+/**
+ * @brief The longest delay or period in ticks, 2^31 - 1: the expiries are compared on the 32-bit wrapping tick count.
+ */
+#define TMR_MAX_DELAY               0x7FFFFFFFUL
+
+/** @} TMR_Types */
+
+/**
+ * @addtogroup TMR_Functions
+ * @{
+ */
+
+/**
+ * @brief Initializes the service and starts its tick.
+ *
+ * With TMR_TICK_SOURCE_STK the SysTick is programmed to call TMR_Tick() every TMR_TICK_US.
+ *
+ * @retval None
+ */
+void TMR_Init(void);
+
+/**
+ * @brief Starts (or restarts) a timer.
+ *
+ * @param[in,out] Copy_Timer Pointer to the timer.
+ * @param[in] Copy_Delay The number of ticks before the first expiry, at least 1 and at most TMR_MAX_DELAY.
+ * @param[in] Copy_Period The number of ticks between the next expiries, 0 for a one-shot timer, at most TMR_MAX_DELAY.
+ * @param[in] Copy_Callback The function called on expiry, from the tick interrupt.
+ * @param[in] Copy_Context The value passed to the callback.
+ * @retval None
+ *
+ * @note A longer delay or period would be taken for an expiry in the past, the timer is not started.
+ */
+void TMR_Start(TMR_Timer_t *Copy_Timer, u32 Copy_Delay, u32 Copy_Period, void (*Copy_Callback)(void *Copy_Context), void *Copy_Context);
+
+/**
+ * @brief Stops a timer, nothing happens when it is not running.
+ *
+ * @param[in,out] Copy_Timer Pointer to the timer.
+ * @retval None
+ */
+void TMR_Stop(TMR_Timer_t *Copy_Timer);
+
+/**
+ * @brief Checks whether a timer is running.
+ *
+ * @param[in] Copy_Timer Pointer to the timer.
+ * @return 1 when the timer is running, 0 otherwise.
+ */
+u8 TMR_IsRunning(const TMR_Timer_t *Copy_Timer);
+
+/**
+ * @brief Gets the number of ticks left before the next expiry of a timer.
+ *
+ * Right after TMR_Start() it is the delay, the tick that expires the timer is the last one counted.
+ *
+ * @param[in] Copy_Timer Pointer to the timer.
+ * @return The number of ticks, 0 when the timer is not running or is overdue.
+ */
+u32 TMR_GetRemainingTicks(const TMR_Timer_t *Copy_Timer);
+
+/**
+ * @brief Gets the number of ticks processed since TMR_Init().
+ *
+ * @return The tick count, wrapping at 2^32.
+ */
+u32 TMR_GetTickCount(void);
+
+/**
+ * @brief Processes one tick: expires the due timers and calls their callbacks.
+ *
+ * Called from the SysTick with TMR_TICK_SOURCE_STK, from the application tick otherwise.
+ *
+ * @retval None
+ */
+void TMR_Tick(void);
+
+/**
+ * @brief Sleeps until the next interrupt, skipping the ticks that have nothing to expire.
+ *
+ * To be called from the idle loop of the application. With TMR_TICKLESS_IDLE_ENABLE the SysTick is programmed to
+ * interrupt on the next tick that has work (an expiry or a cascade of timers), within the 24-bit reload limit; a longer
+ * idle period is covered by calling it again. When another interrupt wakes the core first, the SysTick is set back to
+ * the next tick boundary. The skipped ticks are added to the tick count, the ticks stay on the same time grid.
+ *
+ * @retval None
+ */
+void TMR_Idle(void);
+
+/** @} TMR_Functions */
+
+#endif /**< __TMR_INTERFACE_H__ */
@@ -0,0 +1,95 @@
+/**
+ ********************************************************************************************
+ * @file TMR_private.h
+ * @brief This file contains the private definitions of the software timers service.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+#ifndef __TMR_PRIVATE_H__
+#define __TMR_PRIVATE_H__
+
+/**
+ * @brief Options of TMR_TICK_SOURCE.
+ */
+#define TMR_TICK_SOURCE_STK         0
+#define TMR_TICK_SOURCE_EXTERNAL    1
+
+/**
+ * @brief Options of TMR_TICKLESS_IDLE.
+ */
+#define TMR_TICKLESS_IDLE_DISABLE   0
+#define TMR_TICKLESS_IDLE_ENABLE    1
+
+/**
+ * @brief Wheel geometry: 4 levels of 32 slots, level n slots are 32^n ticks wide.
+ *
+ * The wheel covers 2^20 ticks (about 17 minutes at 1 ms). Longer timers wait in the last slot of the top level and
+ * are placed again each time it cascades.
+ */
+#define TMR_LEVELS                  4
+#define TMR_LEVEL_BITS              5
+#define TMR_SLOTS                   (1 << TMR_LEVEL_BITS)
+#define TMR_SLOT_MASK               (TMR_SLOTS - 1)
+#define TMR_MAX_DELTA               ((1UL << (TMR_LEVELS * TMR_LEVEL_BITS)) - 1)
+
+/**
+ * @brief Slot of a tick in a level.
+ */
+#define TMR_LEVEL_INDEX(TICK, LEVEL)    (((TICK) >> ((LEVEL) * TMR_LEVEL_BITS)) & TMR_SLOT_MASK)
+
+/**
+ * @brief Critical section saving and restoring PRIMASK, so it nests and can be used from interrupts.
+ */
+#define TMR_ENTER_CRITICAL(STATE)   __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (STATE) : : "memory")
+#define TMR_EXIT_CRITICAL(STATE)    __asm volatile ("msr primask, %0" : : "r" (STATE) : "memory")
+
+/**
+ * @brief Waits for an interrupt, it wakes the core even with PRIMASK set.
+ */
+#define TMR_WAIT_FOR_INTERRUPT()    __asm volatile ("wfi" : : : "memory")
+
+/**
+ * @brief Links a timer in the slot matching its expiry.
+ *
+ * @param Copy_Timer Pointer to the timer, not linked.
+ */
+static void TMR_Insert(TMR_Timer_t *Copy_Timer);
+
+/**
+ * @brief Unlinks a timer from its slot list.
+ *
+ * @param Copy_Link Pointer to the timer link.
+ */
+static void TMR_Unlink(TMR_Link_t *Copy_Link);
+
+/**
+ * @brief Moves all the timers of a slot list to another (empty) list head.
+ *
+ * @param Copy_From Pointer to the slot list head, left empty.
+ * @param Copy_To Pointer to the destination list head.
+ */
+static void TMR_MoveList(TMR_Link_t *Copy_From, TMR_Link_t *Copy_To);
+
+/**
+ * @brief Places again the timers of a slot of an upper level, in lower levels now that they are closer.
+ *
+ * @param Copy_Level The level.
+ * @param Copy_Index The slot index.
+ * @return The slot index, the next level cascades too when it is 0.
+ */
+static u8 TMR_Cascade(u8 Copy_Level, u8 Copy_Index);
+
+/**
+ * @brief Finds the next tick that has work: the expiry of a level 0 slot or the cascade of a non-empty upper slot.
+ *
+ * The ticks before it can be skipped, the cascades they would do are of empty slots.
+ *
+ * @return The tick, TMR_Now when it is due now, at most TMR_MAX_DELTA ticks ahead.
+ */
+static u32 TMR_GetNextWorkTick(void);
+
+#endif /**< __TMR_PRIVATE_H__ */
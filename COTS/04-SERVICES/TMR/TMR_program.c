@@ -0,0 +1,314 @@
+/**
+ ********************************************************************************************
+ * @file TMR_program.c
+ * @brief This file contains the implementation of the software timers service.
+ ********************************************************************************************
+ * @date 19 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ ********************************************************************************************
+ */
+
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "STK_interface.h"
+/**< SERVICES */
+#include "TMR_interface.h"
+#include "TMR_config.h"
+#include "TMR_private.h"
+
+/**< Circular list head of every slot of every level */
+static TMR_Link_t TMR_Wheel[TMR_LEVELS][TMR_SLOTS];
+
+/**< Next tick to process */
+static volatile u32 TMR_Now = 0;
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void TMR_Init(void)
+{
+    for (u8 Local_LevelIterator = 0; Local_LevelIterator < TMR_LEVELS; Local_LevelIterator++)
+    {
+        for (u8 Local_SlotIterator = 0; Local_SlotIterator < TMR_SLOTS; Local_SlotIterator++)
+        {
+            TMR_Wheel[Local_LevelIterator][Local_SlotIterator].Next = &TMR_Wheel[Local_LevelIterator][Local_SlotIterator];
+            TMR_Wheel[Local_LevelIterator][Local_SlotIterator].Prev = &TMR_Wheel[Local_LevelIterator][Local_SlotIterator];
+        }
+    }
+    TMR_Now = 0;
+
+#if TMR_TICK_SOURCE == TMR_TICK_SOURCE_STK
+    STK_Init();
+    STK_SetIntervalPeriodic(TMR_TICK_US, TMR_Tick);
+#elif TMR_TICK_SOURCE == TMR_TICK_SOURCE_EXTERNAL
+    /**< The application calls TMR_Tick() every TMR_TICK_US */
+#else
+    #error "Wrong choice of software timers tick source"
+#endif
+}
+
+void TMR_Start(TMR_Timer_t *Copy_Timer, u32 Copy_Delay, u32 Copy_Period, void (*Copy_Callback)(void *Copy_Context), void *Copy_Context)
+{
+    u32 Local_State;
+
+    if ((Copy_Timer == NULL) || (Copy_Callback == NULL) || (Copy_Delay > TMR_MAX_DELAY) || (Copy_Period > TMR_MAX_DELAY))
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    if (Copy_Delay == 0)
+    {
+        Copy_Delay = 1;
+    }
+
+    TMR_ENTER_CRITICAL(Local_State);
+
+    if (Copy_Timer->Link.Next != NULL)
+    {
+        TMR_Unlink(&Copy_Timer->Link);
+    }
+
+    Copy_Timer->Callback = Copy_Callback;
+    Copy_Timer->Context = Copy_Context;
+    Copy_Timer->Period = Copy_Period;
+    /**< TMR_Now is processed by the next tick, which is the first of the delay */
+    Copy_Timer->Expiry = TMR_Now + Copy_Delay - 1;
+    TMR_Insert(Copy_Timer);
+
+    TMR_EXIT_CRITICAL(Local_State);
+}
+
+void TMR_Stop(TMR_Timer_t *Copy_Timer)
+{
+    u32 Local_State;
+
+    if (Copy_Timer == NULL)
+    {
+        /**< RETURN ERROR STATUS */
+        return;
+    }
+
+    TMR_ENTER_CRITICAL(Local_State);
+
+    if (Copy_Timer->Link.Next != NULL)
+    {
+        TMR_Unlink(&Copy_Timer->Link);
+    }
+
+    TMR_EXIT_CRITICAL(Local_State);
+}
+
+u8 TMR_IsRunning(const TMR_Timer_t *Copy_Timer)
+{
+    return (Copy_Timer != NULL) && (Copy_Timer->Link.Next != NULL);
+}
+
+u32 TMR_GetRemainingTicks(const TMR_Timer_t *Copy_Timer)
+{
+    u32 Local_Remaining;
+
+    if (!TMR_IsRunning(Copy_Timer))
+    {
+        /**< RETURN ERROR STATUS */
+        return 0;
+    }
+
+    /**< TMR_Now is processed by the next tick, it counts as the first one left */
+    Local_Remaining = Copy_Timer->Expiry - TMR_Now + 1;
+
+    return ((s32)Local_Remaining < 0) ? 0 : Local_Remaining;
+}
+
+u32 TMR_GetTickCount(void)
+{
+    return TMR_Now;
+}
+
+void TMR_Tick(void)
+{
+    TMR_Link_t Local_Expired;
+    TMR_Timer_t *Local_Timer;
+    u32 Local_State;
+    u8 Local_Index;
+
+    TMR_ENTER_CRITICAL(Local_State);
+
+    /**< Level 0 wrapped: bring the next slot of level 1 down, and of the upper levels when they wrap too */
+    Local_Index = TMR_Now & TMR_SLOT_MASK;
+    if (Local_Index == 0)
+    {
+        for (u8 Local_LevelIterator = 1; Local_LevelIterator < TMR_LEVELS; Local_LevelIterator++)
+        {
+            if (TMR_Cascade(Local_LevelIterator, TMR_LEVEL_INDEX(TMR_Now, Local_LevelIterator)) != 0)
+            {
+                break;
+            }
+        }
+    }
+    TMR_Now++;
+
+    /**< Detach the due timers, a callback may start or stop any timer meanwhile */
+    TMR_MoveList(&TMR_Wheel[0][Local_Index], &Local_Expired);
+
+    while (Local_Expired.Next != &Local_Expired)
+    {
+        Local_Timer = (TMR_Timer_t *)Local_Expired.Next;
+        TMR_Unlink(&Local_Timer->Link);
+
+        if (Local_Timer->Period != 0)
+        {
+            /**< From the expiry, not from now, so a periodic timer does not drift */
+            Local_Timer->Expiry += Local_Timer->Period;
+            TMR_Insert(Local_Timer);
+        }
+
+        TMR_EXIT_CRITICAL(Local_State);
+        Local_Timer->Callback(Local_Timer->Context);
+        TMR_ENTER_CRITICAL(Local_State);
+    }
+
+    TMR_EXIT_CRITICAL(Local_State);
+}
+
+void TMR_Idle(void)
+{
+    u32 Local_State;
+
+    TMR_ENTER_CRITICAL(Local_State);
+
+#if (TMR_TICKLESS_IDLE == TMR_TICKLESS_IDLE_ENABLE) && (TMR_TICK_SOURCE == TMR_TICK_SOURCE_STK)
+    u32 Local_Skipped = 0;
+    u32 Local_IdleTicks = TMR_GetNextWorkTick() - TMR_Now;
+
+    /**< The ticks before the work tick are empty, the interrupt comes on the work tick */
+    if (Local_IdleTicks >= TMR_TICKLESS_MIN_TICKS)
+    {
+        Local_Skipped = STK_SkipIntervals(Local_IdleTicks);
+    }
+
+    TMR_WAIT_FOR_INTERRUPT();
+
+    if (Local_Skipped != 0)
+    {
+        /**< Woken early, the ticks given back run normally */
+        Local_Skipped -= STK_ResumeIntervals();
+        TMR_Now += Local_Skipped;
+    }
+#elif (TMR_TICKLESS_IDLE == TMR_TICKLESS_IDLE_ENABLE) || (TMR_TICKLESS_IDLE == TMR_TICKLESS_IDLE_DISABLE)
+    TMR_WAIT_FOR_INTERRUPT();
+#else
+    #error "Wrong choice of software timers tickless idle"
+#endif
+
+    TMR_EXIT_CRITICAL(Local_State);
+}
+
+/****************************************< PRIVATE FUNCTIONS IMPLEMENTATION ****************************************/
+static void TMR_Insert(TMR_Timer_t *Copy_Timer)
+{
+    u32 Local_Expiry = Copy_Timer->Expiry;
+    u32 Local_Delta = Local_Expiry - TMR_Now;
+    TMR_Link_t *Local_Head;
+    u8 Local_Level = 0;
+
+    if ((s32)Local_Delta < 0)
+    {
+        /**< Already due, processed by the next tick */
+        Local_Head = &TMR_Wheel[0][TMR_Now & TMR_SLOT_MASK];
+    }
+    else
+    {
+        if (Local_Delta > TMR_MAX_DELTA)
+        {
+            /**< Beyond the wheel: wait at its far end, the cascade places it again */
+            Local_Expiry = TMR_Now + TMR_MAX_DELTA;
+            Local_Delta = TMR_MAX_DELTA;
+        }
+
+        /**< Smallest level whose span covers the delay */
+        while ((Local_Level < (TMR_LEVELS - 1)) && (Local_Delta >= (1UL << ((Local_Level + 1) * TMR_LEVEL_BITS))))
+        {
+            Local_Level++;
+        }
+        Local_Head = &TMR_Wheel[Local_Level][TMR_LEVEL_INDEX(Local_Expiry, Local_Level)];
+    }
+
+    /**< Append at the tail */
+    Copy_Timer->Link.Next = Local_Head;
+    Copy_Timer->Link.Prev = Local_Head->Prev;
+    Local_Head->Prev->Next = &Copy_Timer->Link;
+    Local_Head->Prev = &Copy_Timer->Link;
+}
+
+static void TMR_Unlink(TMR_Link_t *Copy_Link)
+{
+    Copy_Link->Prev->Next = Copy_Link->Next;
+    Copy_Link->Next->Prev = Copy_Link->Prev;
+    Copy_Link->Next = NULL;
+    Copy_Link->Prev = NULL;
+}
+
+static void TMR_MoveList(TMR_Link_t *Copy_From, TMR_Link_t *Copy_To)
+{
+    if (Copy_From->Next == Copy_From)
+    {
+        Copy_To->Next = Copy_To;
+        Copy_To->Prev = Copy_To;
+    }
+    else
+    {
+        Copy_To->Next = Copy_From->Next;
+        Copy_To->Prev = Copy_From->Prev;
+        Copy_To->Next->Prev = Copy_To;
+        Copy_To->Prev->Next = Copy_To;
+        Copy_From->Next = Copy_From;
+        Copy_From->Prev = Copy_From;
+    }
+}
+
+static u8 TMR_Cascade(u8 Copy_Level, u8 Copy_Index)
+{
+    TMR_Link_t Local_List;
+    TMR_Timer_t *Local_Timer;
+
+    TMR_MoveList(&TMR_Wheel[Copy_Level][Copy_Index], &Local_List);
+
+    while (Local_List.Next != &Local_List)
+    {
+        Local_Timer = (TMR_Timer_t *)Local_List.Next;
+        TMR_Unlink(&Local_Timer->Link);
+        TMR_Insert(Local_Timer);
+    }
+
+    return Copy_Index;
+}
+
+static u32 TMR_GetNextWorkTick(void)
+{
+    u32 Local_Next = TMR_Now + TMR_MAX_DELTA;
+    u32 Local_Width;
+    u32 Local_Tick;
+
+    for (u8 Local_LevelIterator = 0; Local_LevelIterator < TMR_LEVELS; Local_LevelIterator++)
+    {
+        /**< A level cascades (or expires, level 0) one slot on each multiple of its slot width */
+        Local_Width = 1UL << (Local_LevelIterator * TMR_LEVEL_BITS);
+        Local_Tick = (TMR_Now + Local_Width - 1) & ~(Local_Width - 1);
+
+        for (u8 Local_SlotIterator = 0; (Local_SlotIterator < TMR_SLOTS) && ((s32)(Local_Tick - Local_Next) < 0); Local_SlotIterator++)
+        {
+            TMR_Link_t *Local_Head = &TMR_Wheel[Local_LevelIterator][TMR_LEVEL_INDEX(Local_Tick, Local_LevelIterator)];
+
+            if (Local_Head->Next != Local_Head)
+            {
+                Local_Next = Local_Tick;
+                break;
+            }
+            Local_Tick += Local_Width;
+        }
+    }
+
+    return Local_Next;
+}